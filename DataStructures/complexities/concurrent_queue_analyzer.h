@@ -0,0 +1,279 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/concurrent_queue.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for analyzers of queues shared by two threads.
+     *
+     * The analyzed structure is the number of elements transferred by one operation,
+     * so the results show how the transfer time grows with the element count.
+     */
+    class ConcurrentQueueAnalyzer : public ComplexityAnalyzer<size_t>
+    {
+    protected:
+        explicit ConcurrentQueueAnalyzer(const std::string& name);
+
+    protected:
+        void growToSize(size_t& structure, size_t size) override;
+    };
+
+    /**
+     * @brief Analyzes throughput of a producer thread pushing elements one by one
+     *        to a consumer thread.
+     */
+    template<class Queue>
+    class QueueThroughputAnalyzer : public ConcurrentQueueAnalyzer
+    {
+    public:
+        explicit QueueThroughputAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(size_t& structure) override;
+
+    private:
+        Queue queue_;
+    };
+
+    /**
+     * @brief Analyzes throughput of a producer thread pushing elements in batches
+     *        to a consumer thread.
+     */
+    template<class Queue>
+    class QueueBatchThroughputAnalyzer : public ConcurrentQueueAnalyzer
+    {
+    public:
+        explicit QueueBatchThroughputAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(size_t& structure) override;
+
+    private:
+        static const size_t BATCH_SIZE = 64;
+
+    private:
+        Queue queue_;
+    };
+
+    /**
+     * @brief Analyzes round-trip latency of an element sent to an echo thread and back.
+     */
+    template<class Queue>
+    class QueuePingPongAnalyzer : public ConcurrentQueueAnalyzer
+    {
+    public:
+        explicit QueuePingPongAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(size_t& structure) override;
+
+    private:
+        Queue ping_;
+        Queue pong_;
+    };
+
+    /**
+     * @brief Analyzes throughput of a queue shared by several producer and
+     *        as many consumer threads.
+     */
+    template<class Queue>
+    class QueueContentionAnalyzer : public ConcurrentQueueAnalyzer
+    {
+    public:
+        QueueContentionAnalyzer(const std::string& name, size_t threadCount);
+
+    protected:
+        void executeOperation(size_t& structure) override;
+
+    private:
+        Queue queue_;
+        size_t threadCount_;
+    };
+
+    /**
+     * @brief Container for all concurrent queue analyzers.
+     */
+    class ConcurrentQueuesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        ConcurrentQueuesAnalyzer();
+    };
+
+    //----------
+
+    inline ConcurrentQueueAnalyzer::ConcurrentQueueAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<size_t>(name)
+    {
+    }
+
+    inline void ConcurrentQueueAnalyzer::growToSize(size_t& structure, size_t size)
+    {
+        structure = size;
+    }
+
+    //----------
+
+    template<class Queue>
+    QueueThroughputAnalyzer<Queue>::QueueThroughputAnalyzer(const std::string& name) :
+        ConcurrentQueueAnalyzer(name)
+    {
+    }
+
+    template<class Queue>
+    void QueueThroughputAnalyzer<Queue>::executeOperation(size_t& structure)
+    {
+        const size_t count = structure;
+        std::thread producer([this, count]()
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    queue_.push(static_cast<int>(i));
+                }
+            });
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            queue_.pop();
+        }
+
+        producer.join();
+    }
+
+    //----------
+
+    template<class Queue>
+    QueueBatchThroughputAnalyzer<Queue>::QueueBatchThroughputAnalyzer(const std::string& name) :
+        ConcurrentQueueAnalyzer(name)
+    {
+    }
+
+    template<class Queue>
+    void QueueBatchThroughputAnalyzer<Queue>::executeOperation(size_t& structure)
+    {
+        const size_t count = structure;
+        std::thread producer([this, count]()
+            {
+                std::vector<int> batch(BATCH_SIZE);
+                size_t pushed = 0;
+                while (pushed < count)
+                {
+                    const size_t toPush = (std::min)(BATCH_SIZE, count - pushed);
+                    const size_t n = queue_.pushBatch(batch.data(), toPush);
+                    if (n == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    pushed += n;
+                }
+            });
+
+        std::vector<int> batch(BATCH_SIZE);
+        size_t popped = 0;
+        while (popped < count)
+        {
+            const size_t n = queue_.popBatch(batch.data(), BATCH_SIZE);
+            if (n == 0)
+            {
+                std::this_thread::yield();
+            }
+            popped += n;
+        }
+
+        producer.join();
+    }
+
+    //----------
+
+    template<class Queue>
+    QueuePingPongAnalyzer<Queue>::QueuePingPongAnalyzer(const std::string& name) :
+        ConcurrentQueueAnalyzer(name)
+    {
+    }
+
+    template<class Queue>
+    void QueuePingPongAnalyzer<Queue>::executeOperation(size_t& structure)
+    {
+        const size_t count = structure;
+        std::thread echo([this, count]()
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    pong_.push(ping_.pop());
+                }
+            });
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            ping_.push(static_cast<int>(i));
+            pong_.pop();
+        }
+
+        echo.join();
+    }
+
+    //----------
+
+    template<class Queue>
+    QueueContentionAnalyzer<Queue>::QueueContentionAnalyzer(const std::string& name, size_t threadCount) :
+        ConcurrentQueueAnalyzer(name),
+        threadCount_(threadCount)
+    {
+    }
+
+    template<class Queue>
+    void QueueContentionAnalyzer<Queue>::executeOperation(size_t& structure)
+    {
+        const size_t perThread = structure / threadCount_;
+        std::vector<std::thread> threads;
+        threads.reserve(2 * threadCount_);
+
+        for (size_t t = 0; t < threadCount_; ++t)
+        {
+            threads.emplace_back([this, perThread]()
+                {
+                    for (size_t i = 0; i < perThread; ++i)
+                    {
+                        queue_.push(static_cast<int>(i));
+                    }
+                });
+            threads.emplace_back([this, perThread]()
+                {
+                    for (size_t i = 0; i < perThread; ++i)
+                    {
+                        queue_.pop();
+                    }
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    //----------
+
+    inline ConcurrentQueuesAnalyzer::ConcurrentQueuesAnalyzer() :
+        CompositeAnalyzer("ConcurrentQueues")
+    {
+        this->addAnalyzer(std::make_unique<QueueThroughputAnalyzer<adt::SpscQueue<int>>>("spsc-throughput"));
+        this->addAnalyzer(std::make_unique<QueueBatchThroughputAnalyzer<adt::SpscQueue<int>>>("spsc-batch-throughput"));
+        this->addAnalyzer(std::make_unique<QueuePingPongAnalyzer<adt::SpscQueue<int>>>("spsc-ping-pong"));
+        this->addAnalyzer(std::make_unique<QueueThroughputAnalyzer<adt::MpmcQueue<int>>>("mpmc-throughput"));
+        this->addAnalyzer(std::make_unique<QueuePingPongAnalyzer<adt::MpmcQueue<int>>>("mpmc-ping-pong"));
+
+        const size_t maxThreadCount = (std::max)(1u, std::thread::hardware_concurrency());
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+        {
+            this->addAnalyzer(std::make_unique<QueueContentionAnalyzer<adt::MpmcQueue<int>>>(
+                "mpmc-contention-" + std::to_string(threadCount), threadCount
+            ));
+        }
+    }
+}
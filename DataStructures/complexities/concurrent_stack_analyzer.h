@@ -0,0 +1,87 @@
+#pragma once
+
+#include <complexities/concurrent_queue_analyzer.h>
+#include <libds/adt/concurrent_stack.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes throughput of a stack shared by several threads,
+     *        each pushing and popping its share of the elements.
+     */
+    template<class Stack>
+    class StackContentionAnalyzer : public ConcurrentQueueAnalyzer
+    {
+    public:
+        StackContentionAnalyzer(const std::string& name, size_t threadCount);
+
+    protected:
+        void executeOperation(size_t& structure) override;
+
+    private:
+        Stack stack_;
+        size_t threadCount_;
+    };
+
+    /**
+     * @brief Container for all concurrent stack analyzers.
+     */
+    class ConcurrentStacksAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        ConcurrentStacksAnalyzer();
+    };
+
+    //----------
+
+    template<class Stack>
+    StackContentionAnalyzer<Stack>::StackContentionAnalyzer(const std::string& name, size_t threadCount) :
+        ConcurrentQueueAnalyzer(name),
+        threadCount_(threadCount)
+    {
+    }
+
+    template<class Stack>
+    void StackContentionAnalyzer<Stack>::executeOperation(size_t& structure)
+    {
+        const size_t perThread = structure / threadCount_;
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount_);
+
+        for (size_t t = 0; t < threadCount_; ++t)
+        {
+            threads.emplace_back([this, perThread]()
+                {
+                    int value;
+                    for (size_t i = 0; i < perThread; ++i)
+                    {
+                        stack_.push(static_cast<int>(i));
+                        stack_.tryPop(value);
+                    }
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    //----------
+
+    inline ConcurrentStacksAnalyzer::ConcurrentStacksAnalyzer() :
+        CompositeAnalyzer("ConcurrentStacks")
+    {
+        const size_t maxThreadCount = (std::max)(1u, std::thread::hardware_concurrency());
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+        {
+            this->addAnalyzer(std::make_unique<StackContentionAnalyzer<adt::ConcurrentStack<int>>>(
+                "treiber-contention-" + std::to_string(threadCount), threadCount
+            ));
+        }
+    }
+}
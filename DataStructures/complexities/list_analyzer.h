@@ -1,6 +1,9 @@
 #pragma once
 
 #include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
 #include <list>
 #include <random>
 #include <vector>
@@ -55,6 +58,96 @@ namespace ds::utils
         void executeOperation(List& structure) override;
     };
 
+    /**
+     * @brief Explicit sequence whose blocks are allocated by a PoolMemoryManager, also when copied.
+     */
+    template<class Sequence>
+    class PooledSequence : public Sequence
+    {
+    public:
+        PooledSequence();
+        PooledSequence(const PooledSequence& other);
+    };
+
+    /**
+     * @brief Implicit sequence kept in the gap buffer layout, also when copied.
+     */
+    template<class Sequence>
+    class GapBufferedSequence : public Sequence
+    {
+    public:
+        GapBufferedSequence();
+        GapBufferedSequence(const GapBufferedSequence& other);
+    };
+
+    /**
+     * @brief Common base for analyzers of sequences.
+     */
+    template<class Sequence>
+    class SequenceAnalyzer : public ComplexityAnalyzer<Sequence>
+    {
+    protected:
+        explicit SequenceAnalyzer(const std::string& name);
+
+    protected:
+        void growToSize(Sequence& structure, size_t size) override;
+
+        int getRandomData() const;
+
+    private:
+        std::default_random_engine rngData_;
+        int data_;
+    };
+
+    /**
+     * @brief Analyzes throughput of an allocation by an insertion at the beginning.
+     */
+    template<class Sequence>
+    class SequenceInsertAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceInsertAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+    };
+
+    /**
+     * @brief Analyzes locality of blocks by a traversal of the whole sequence.
+     */
+    template<class Sequence>
+    class SequenceTraverseAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceTraverseAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+
+    private:
+        long long checksum_;
+    };
+
+    /**
+     * @brief Analyzes clustered inserts, a burst of CLUSTER_SIZE insertions at consecutive indices
+     *        starting at a random index.
+     */
+    template<class Sequence>
+    class SequenceClusteredInsertAnalyzer : public SequenceAnalyzer<Sequence>
+    {
+    public:
+        explicit SequenceClusteredInsertAnalyzer(const std::string& name);
+
+        static const size_t CLUSTER_SIZE = 64;
+
+    protected:
+        void executeOperation(Sequence& structure) override;
+
+    private:
+        std::default_random_engine rngIndex_;
+        size_t index_;
+    };
+
     /**
      * @brief Container for all list analyzers.
      */
@@ -135,6 +228,125 @@ namespace ds::utils
 
     //----------
 
+    template<class Sequence>
+    PooledSequence<Sequence>::PooledSequence() :
+        Sequence(new mm::PoolMemoryManager<typename Sequence::BlockType>())
+    {
+    }
+
+    template<class Sequence>
+    PooledSequence<Sequence>::PooledSequence(const PooledSequence& other) :
+        PooledSequence()
+    {
+        this->assign(other);
+    }
+
+    //----------
+
+    template<class Sequence>
+    GapBufferedSequence<Sequence>::GapBufferedSequence()
+    {
+        this->setGapBuffer(true);
+    }
+
+    template<class Sequence>
+    GapBufferedSequence<Sequence>::GapBufferedSequence(const GapBufferedSequence& other) :
+        GapBufferedSequence()
+    {
+        this->assign(other);
+    }
+
+    //----------
+
+    template<class Sequence>
+    SequenceAnalyzer<Sequence>::SequenceAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Sequence>(name),
+        rngData_(144),
+        data_(0)
+    {
+        ComplexityAnalyzer<Sequence>::registerBeforeOperation([this](Sequence&)
+            {
+                data_ = rngData_();
+            });
+    }
+
+    template<class Sequence>
+    void SequenceAnalyzer<Sequence>::growToSize(Sequence& structure, size_t size)
+    {
+        const size_t toInsert = size - structure.size();
+        for (size_t i = 0; i < toInsert; ++i)
+        {
+            structure.insertLast().data_ = rngData_();
+        }
+    }
+
+    template<class Sequence>
+    int SequenceAnalyzer<Sequence>::getRandomData() const
+    {
+        return data_;
+    }
+
+    //----------
+
+    template<class Sequence>
+    SequenceInsertAnalyzer<Sequence>::SequenceInsertAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceInsertAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        structure.insertFirst().data_ = this->getRandomData();
+    }
+
+    //----------
+
+    template<class Sequence>
+    SequenceTraverseAnalyzer<Sequence>::SequenceTraverseAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name),
+        checksum_(0)
+    {
+    }
+
+    template<class Sequence>
+    void SequenceTraverseAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        long long sum = 0;
+        for (const auto data : structure)
+        {
+            sum += data;
+        }
+        // Keeps the traversal from being optimized away.
+        checksum_ += sum;
+    }
+
+    //----------
+
+    template<class Sequence>
+    SequenceClusteredInsertAnalyzer<Sequence>::SequenceClusteredInsertAnalyzer(const std::string& name) :
+        SequenceAnalyzer<Sequence>(name),
+        rngIndex_(144),
+        index_(0)
+    {
+        ComplexityAnalyzer<Sequence>::registerBeforeOperation([this](Sequence& sequence)
+            {
+                std::uniform_int_distribution<size_t> indexDist(0, sequence.size());
+                index_ = indexDist(rngIndex_);
+            });
+    }
+
+    template<class Sequence>
+    void SequenceClusteredInsertAnalyzer<Sequence>::executeOperation(Sequence& structure)
+    {
+        for (size_t i = 0; i < CLUSTER_SIZE; ++i)
+        {
+            structure.insert(index_ + i).data_ = static_cast<int>(i);
+        }
+    }
+
+    //----------
+
     inline ListsAnalyzer::ListsAnalyzer() :
         CompositeAnalyzer("Lists")
     {
@@ -142,5 +354,18 @@ namespace ds::utils
         this->addAnalyzer(std::make_unique<ListInsertAnalyzer<std::list<int>>>("list-insert"));
         this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<std::vector<int>>>("vector-remove"));
         this->addAnalyzer(std::make_unique<ListRemoveAnalyzer<std::list<int>>>("list-remove"));
+
+        using DoublyLS = amt::DoublyLinkedSequence<int>;
+        using PooledDoublyLS = PooledSequence<amt::DoublyLinkedSequence<int>>;
+        this->addAnalyzer(std::make_unique<SequenceInsertAnalyzer<DoublyLS>>("doubly-insert"));
+        this->addAnalyzer(std::make_unique<SequenceInsertAnalyzer<PooledDoublyLS>>("doubly-pool-insert"));
+        this->addAnalyzer(std::make_unique<SequenceTraverseAnalyzer<DoublyLS>>("doubly-traverse"));
+        this->addAnalyzer(std::make_unique<SequenceTraverseAnalyzer<PooledDoublyLS>>("doubly-pool-traverse"));
+
+        using IS = amt::ImplicitSequence<int>;
+        using GapBufferedIS = GapBufferedSequence<amt::ImplicitSequence<int>>;
+        this->addAnalyzer(std::make_unique<SequenceClusteredInsertAnalyzer<IS>>("implicit-clustered-insert"));
+        this->addAnalyzer(std::make_unique<SequenceClusteredInsertAnalyzer<GapBufferedIS>>("implicit-gap-clustered-insert"));
+        this->addAnalyzer(std::make_unique<SequenceClusteredInsertAnalyzer<DoublyLS>>("doubly-clustered-insert"));
     }
 }
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <complexities/concurrent_queue_analyzer.h>
+#include <libds/amt/explicit_sequence.h>
+#include <libds/mm/memory_manager.h>
+#include <libds/mm/thread_caching_memory_manager.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes allocation throughput of several threads, each allocating its share
+     *        of list blocks and then releasing the blocks allocated by its neighbour.
+     */
+    template<class Manager>
+    class AllocationContentionAnalyzer : public ConcurrentQueueAnalyzer
+    {
+    public:
+        AllocationContentionAnalyzer(const std::string& name, size_t threadCount);
+
+    protected:
+        void executeOperation(size_t& structure) override;
+
+    private:
+        using BlockType = amt::DoublyLinkedSequence<int>::BlockType;
+
+    private:
+        size_t threadCount_;
+    };
+
+    /**
+     * @brief Container for all memory manager analyzers.
+     */
+    class MemoryManagersAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        MemoryManagersAnalyzer();
+    };
+
+    //----------
+
+    template<class Manager>
+    AllocationContentionAnalyzer<Manager>::AllocationContentionAnalyzer(const std::string& name, size_t threadCount) :
+        ConcurrentQueueAnalyzer(name),
+        threadCount_(threadCount)
+    {
+    }
+
+    template<class Manager>
+    void AllocationContentionAnalyzer<Manager>::executeOperation(size_t& structure)
+    {
+        const size_t perThread = structure / threadCount_;
+        std::vector<std::unique_ptr<Manager>> managers;
+        std::vector<std::vector<BlockType*>> blocks(threadCount_);
+        for (size_t t = 0; t < threadCount_; ++t)
+        {
+            managers.push_back(std::make_unique<Manager>());
+            blocks[t].reserve(perThread);
+        }
+
+        std::atomic<size_t> allocated(0);
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount_);
+
+        for (size_t t = 0; t < threadCount_; ++t)
+        {
+            threads.emplace_back([this, t, perThread, &managers, &blocks, &allocated]()
+                {
+                    for (size_t i = 0; i < perThread; ++i)
+                    {
+                        blocks[t].push_back(managers[t]->allocateMemory());
+                    }
+
+                    ++allocated;
+                    while (allocated.load() < threadCount_)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    // Every manager is used by one thread at a time, the blocks come from another thread.
+                    const size_t neighbour = (t + 1) % threadCount_;
+                    for (BlockType* block : blocks[neighbour])
+                    {
+                        managers[neighbour]->releaseMemory(block);
+                    }
+                });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    //----------
+
+    inline MemoryManagersAnalyzer::MemoryManagersAnalyzer() :
+        CompositeAnalyzer("MemoryManagers")
+    {
+        using BlockType = amt::DoublyLinkedSequence<int>::BlockType;
+        const size_t maxThreadCount = (std::max)(1u, std::thread::hardware_concurrency());
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+        {
+            this->addAnalyzer(std::make_unique<AllocationContentionAnalyzer<mm::MemoryManager<BlockType>>>(
+                "new-delete-" + std::to_string(threadCount), threadCount
+            ));
+            this->addAnalyzer(std::make_unique<AllocationContentionAnalyzer<mm::ThreadCachingMemoryManager<BlockType>>>(
+                "thread-cache-" + std::to_string(threadCount), threadCount
+            ));
+        }
+    }
+}
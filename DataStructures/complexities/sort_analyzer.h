@@ -0,0 +1,238 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/sorts.h>
+#include <libds/amt/implicit_sequence.h>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ds::utils
+{
+    /**
+     * @brief Record with two string keys, like a stop with its municipality and street.
+     */
+    struct SortRecord
+    {
+        std::string municipality_;
+        std::string street_;
+    };
+
+    /**
+     * @brief Orders records by municipality, then by street.
+     */
+    struct SortRecordComparator
+    {
+        bool operator()(const SortRecord* lhs, const SortRecord* rhs) const
+        {
+            return lhs->municipality_ != rhs->municipality_
+                ? lhs->municipality_ < rhs->municipality_
+                : lhs->street_ < rhs->street_;
+        }
+    };
+
+    /**
+     * @brief Order of the keys before each sort.
+     */
+    enum class SortInput
+    {
+        Random,
+        Sorted,
+        Reversed,
+        NoisySorted
+    };
+
+    /**
+     * @brief Analyzes sorting of a shuffled implicit sequence of int or SortRecord* keys.
+     *
+     * With virtual dispatch, the sort is called through Sort<T> with a std::function
+     * comparator. Otherwise, the templated overload of the sorter inlines @p Compare.
+     * Shuffled keys can be arranged into sorted, reversed or sorted order with 1% of keys swapped.
+     */
+    template<class Sorter, typename T, class Compare>
+    class SortAnalyzer : public ComplexityAnalyzer<amt::ImplicitSequence<T>>
+    {
+    public:
+        SortAnalyzer(const std::string& name, bool virtualDispatch);
+        SortAnalyzer(const std::string& name, bool virtualDispatch, SortInput input);
+
+    protected:
+        void growToSize(amt::ImplicitSequence<T>& structure, size_t size) override;
+        void executeOperation(amt::ImplicitSequence<T>& structure) override;
+
+    private:
+        T getKey(size_t index);
+        void arrange(amt::ImplicitSequence<T>& structure);
+
+    private:
+        Sorter sorter_;
+        Compare compare_;
+        bool virtualDispatch_;
+        SortInput input_;
+        std::default_random_engine rng_;
+        std::deque<SortRecord> records_;
+    };
+
+    /**
+     * @brief Container for all sort analyzers.
+     */
+    class SortsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        SortsAnalyzer();
+    };
+
+    /**
+     * @brief Container for analyzers comparing sorts on random, sorted, reversed and nearly sorted keys.
+     */
+    class AdaptiveSortsAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        AdaptiveSortsAnalyzer();
+    };
+
+    //----------
+
+    template<class Sorter, typename T, class Compare>
+    SortAnalyzer<Sorter, T, Compare>::SortAnalyzer(const std::string& name, bool virtualDispatch) :
+        SortAnalyzer(name, virtualDispatch, SortInput::Random)
+    {
+    }
+
+    template<class Sorter, typename T, class Compare>
+    SortAnalyzer<Sorter, T, Compare>::SortAnalyzer(const std::string& name, bool virtualDispatch, SortInput input) :
+        ComplexityAnalyzer<amt::ImplicitSequence<T>>(name),
+        virtualDispatch_(virtualDispatch),
+        input_(input),
+        rng_(144)
+    {
+        this->registerBeforeOperation([this](amt::ImplicitSequence<T>& structure)
+            {
+                for (size_t i = structure.size(); i > 1; --i)
+                {
+                    std::uniform_int_distribution<size_t> indexDist(0, i - 1);
+                    using std::swap;
+                    swap(structure.access(i - 1)->data_, structure.access(indexDist(rng_))->data_);
+                }
+                this->arrange(structure);
+            });
+    }
+
+    template<class Sorter, typename T, class Compare>
+    void SortAnalyzer<Sorter, T, Compare>::growToSize(amt::ImplicitSequence<T>& structure, size_t size)
+    {
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            structure.insertLast().data_ = this->getKey(i);
+        }
+    }
+
+    template<class Sorter, typename T, class Compare>
+    void SortAnalyzer<Sorter, T, Compare>::executeOperation(amt::ImplicitSequence<T>& structure)
+    {
+        if (virtualDispatch_)
+        {
+            adt::Sort<T>& sort = sorter_;
+            sort.sort(structure, compare_);
+        }
+        else
+        {
+            sorter_.sort(structure, compare_);
+        }
+    }
+
+    template<class Sorter, typename T, class Compare>
+    T SortAnalyzer<Sorter, T, Compare>::getKey(size_t index)
+    {
+        if constexpr (std::is_same_v<T, SortRecord*>)
+        {
+            // Records are shared by all replications, the i-th key of a sequence is always the i-th record.
+            while (records_.size() <= index)
+            {
+                records_.push_back({
+                    "municipality-" + std::to_string(rng_() % 100),
+                    "street-" + std::to_string(rng_() % 10'000)
+                });
+            }
+            return &records_[index];
+        }
+        else
+        {
+            return static_cast<T>(rng_());
+        }
+    }
+
+    template<class Sorter, typename T, class Compare>
+    void SortAnalyzer<Sorter, T, Compare>::arrange(amt::ImplicitSequence<T>& structure)
+    {
+        if (input_ == SortInput::Random || structure.isEmpty())
+        {
+            return;
+        }
+
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+        structure.makeContiguous();
+        BlockType* blocks = structure.accessFirst();
+        const size_t size = structure.size();
+
+        if (input_ == SortInput::Reversed)
+        {
+            std::sort(blocks, blocks + size, [this](const BlockType& lhs, const BlockType& rhs) { return compare_(rhs.data_, lhs.data_); });
+            return;
+        }
+
+        std::sort(blocks, blocks + size, [this](const BlockType& lhs, const BlockType& rhs) { return compare_(lhs.data_, rhs.data_); });
+        if (input_ == SortInput::NoisySorted)
+        {
+            std::uniform_int_distribution<size_t> indexDist(0, size - 1);
+            for (size_t i = 0; i < size / 100; ++i)
+            {
+                using std::swap;
+                swap(blocks[indexDist(rng_)].data_, blocks[indexDist(rng_)].data_);
+            }
+        }
+    }
+
+    //----------
+
+    inline SortsAnalyzer::SortsAnalyzer() :
+        CompositeAnalyzer("Sorts")
+    {
+        using IntSort = adt::IntroSort<int>;
+        using RecordSort = adt::IntroSort<SortRecord*>;
+
+        this->addAnalyzer(std::make_unique<SortAnalyzer<IntSort, int, std::less<int>>>("introsort-int-virtual", true));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<IntSort, int, std::less<int>>>("introsort-int-template", false));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<RecordSort, SortRecord*, SortRecordComparator>>("introsort-record-virtual", true));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<RecordSort, SortRecord*, SortRecordComparator>>("introsort-record-template", false));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<adt::MergeSort<int>, int, std::less<int>>>("mergesort-int", false));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<adt::ParallelMergeSort<int>, int, std::less<int>>>("parallel-mergesort-int", false));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<adt::SampleSort<int>, int, std::less<int>>>("samplesort-int", false));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<adt::RadixSort<int, int>, int, std::less<int>>>("radixsort-int", false));
+        this->addAnalyzer(std::make_unique<SortAnalyzer<adt::TimSort<int>, int, std::less<int>>>("timsort-int", false));
+    }
+
+    inline AdaptiveSortsAnalyzer::AdaptiveSortsAnalyzer() :
+        CompositeAnalyzer("AdaptiveSorts")
+    {
+        const std::pair<SortInput, std::string> inputs[] = {
+            { SortInput::Random, "random" },
+            { SortInput::Sorted, "sorted" },
+            { SortInput::Reversed, "reversed" },
+            { SortInput::NoisySorted, "noisy" }
+        };
+
+        // QuickSort picks the last key as pivot, on presorted keys its recursion is as deep as the sequence.
+        this->addAnalyzer(std::make_unique<SortAnalyzer<adt::QuickSort<int>, int, std::less<int>>>("quicksort-random", true, SortInput::Random));
+        for (const auto& [input, name] : inputs)
+        {
+            this->addAnalyzer(std::make_unique<SortAnalyzer<adt::IntroSort<int>, int, std::less<int>>>("introsort-" + name, false, input));
+            this->addAnalyzer(std::make_unique<SortAnalyzer<adt::MergeSort<int>, int, std::less<int>>>("mergesort-" + name, false, input));
+            this->addAnalyzer(std::make_unique<SortAnalyzer<adt::TimSort<int>, int, std::less<int>>>("timsort-" + name, false, input));
+        }
+    }
+}
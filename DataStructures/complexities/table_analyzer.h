@@ -0,0 +1,115 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/table.h>
+#include <random>
+
+namespace ds::utils
+{
+    /**
+     * @brief Sequence table whose implicit sequence is kept in the gap buffer layout, also when copied.
+     */
+    template<class Table>
+    class GapBufferedTable : public Table
+    {
+    public:
+        GapBufferedTable();
+        GapBufferedTable(const GapBufferedTable& other);
+    };
+
+    /**
+     * @brief Analyzes clustered inserts into a table, a burst of CLUSTER_SIZE keys that follow
+     *        a random key and so end up next to each other.
+     *
+     * Tables are grown by keys that are multiples of KEY_STRIDE, the clustered keys lie between them.
+     */
+    template<class Table>
+    class TableClusteredInsertAnalyzer : public ComplexityAnalyzer<Table>
+    {
+    public:
+        explicit TableClusteredInsertAnalyzer(const std::string& name);
+
+        static const int CLUSTER_SIZE = 64;
+        static const int KEY_STRIDE = 2 * CLUSTER_SIZE;
+
+    protected:
+        void growToSize(Table& structure, size_t size) override;
+        void executeOperation(Table& structure) override;
+
+    private:
+        std::default_random_engine rngKey_;
+        int key_;
+    };
+
+    /**
+     * @brief Container for all table analyzers.
+     */
+    class TablesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        TablesAnalyzer();
+    };
+
+    //----------
+
+    template<class Table>
+    GapBufferedTable<Table>::GapBufferedTable()
+    {
+        this->getSequence()->setGapBuffer(true);
+    }
+
+    template<class Table>
+    GapBufferedTable<Table>::GapBufferedTable(const GapBufferedTable& other) :
+        GapBufferedTable()
+    {
+        this->assign(other);
+    }
+
+    //----------
+
+    template<class Table>
+    TableClusteredInsertAnalyzer<Table>::TableClusteredInsertAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Table>(name),
+        rngKey_(144),
+        key_(0)
+    {
+        ComplexityAnalyzer<Table>::registerBeforeOperation([this](Table& table)
+            {
+                std::uniform_int_distribution<size_t> keyDist(0, table.size());
+                key_ = static_cast<int>(keyDist(rngKey_)) * KEY_STRIDE;
+            });
+    }
+
+    template<class Table>
+    void TableClusteredInsertAnalyzer<Table>::growToSize(Table& structure, size_t size)
+    {
+        // Every grown key is above the previous ones, since the size never decreases.
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            structure.insert(static_cast<int>(i) * KEY_STRIDE, static_cast<int>(i));
+        }
+    }
+
+    template<class Table>
+    void TableClusteredInsertAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        for (int i = 1; i <= CLUSTER_SIZE; ++i)
+        {
+            if (!structure.contains(key_ + i))
+            {
+                structure.insert(key_ + i, i);
+            }
+        }
+    }
+
+    //----------
+
+    inline TablesAnalyzer::TablesAnalyzer() :
+        CompositeAnalyzer("Tables")
+    {
+        using SortedTable = adt::SortedSequenceTable<int, int>;
+        using GapBufferedSortedTable = GapBufferedTable<adt::SortedSequenceTable<int, int>>;
+        this->addAnalyzer(std::make_unique<TableClusteredInsertAnalyzer<SortedTable>>("sorted-clustered-insert"));
+        this->addAnalyzer(std::make_unique<TableClusteredInsertAnalyzer<GapBufferedSortedTable>>("sorted-gap-clustered-insert"));
+    }
+}
@@ -47,6 +47,11 @@ namespace ds::adt {
         bool isEmpty() const override;
         bool equals(const ADT& other) override;
 
+        /**
+         * @brief Returns the allocation accounting of the underlying memory structure.
+         */
+        mm::MemoryStatistics getMemoryStatistics() const;
+
     protected:
         amt::AMT* memoryStructure_;
     };
@@ -116,6 +121,12 @@ namespace ds::adt {
         return this->size() == 0;
     }
 
+    template<typename T>
+    mm::MemoryStatistics AbstractDataStructure<T>::getMemoryStatistics() const
+    {
+        return memoryStructure_->getMemoryStatistics();
+    }
+
     template<typename T>
     bool AbstractDataStructure<T>::equals(const ADT& other)
     {
@@ -0,0 +1,436 @@
+#pragma once
+
+#include <libds/amt/implicit_sequence.h>
+#include <libds/constants.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+namespace ds::adt {
+
+    /**
+     * @brief Lock-free queue for exactly one producer thread and one consumer thread.
+     *
+     * Elements live in a power-of-two ring of a cyclic implicit sequence. Head and tail
+     * are ever-increasing counters masked into the ring. The producer publishes the tail
+     * with release semantics, the consumer publishes the head, and each counter sits on
+     * its own cache line together with the owner's cached copy of the other counter.
+     */
+    template<typename T>
+    class SpscQueue
+    {
+    public:
+        SpscQueue();
+        explicit SpscQueue(size_t capacity);
+        SpscQueue(const SpscQueue& other) = delete;
+        SpscQueue& operator=(const SpscQueue& other) = delete;
+        ~SpscQueue();
+
+        size_t getCapacity() const;
+        size_t size() const;
+        bool isEmpty() const;
+
+        bool tryPush(const T& element);
+        void push(const T& element);
+        bool tryPop(T& output);
+        T pop();
+
+        /**
+         * @brief Pushes up to @p count elements, copying at most two contiguous spans.
+         * @return Number of pushed elements (limited by free space).
+         */
+        size_t pushBatch(const T* elements, size_t count);
+
+        /**
+         * @brief Pops up to @p count elements, moving at most two contiguous spans.
+         * @return Number of popped elements.
+         */
+        size_t popBatch(T* output, size_t count);
+
+        static const size_t INIT_CAPACITY = 1024;
+
+    private:
+        using BlockType = typename amt::CIS<T>::BlockType;
+
+        static size_t roundUpToPowerOfTwo(size_t n);
+
+    private:
+        amt::CIS<T>* sequence_;
+        BlockType* blocks_;
+        size_t mask_;
+
+        // Written by the consumer.
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_;
+        size_t cachedTail_;
+
+        // Written by the producer.
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+        size_t cachedHead_;
+    };
+
+    //----------
+
+    /**
+     * @brief Bounded lock-free queue for any number of producer and consumer threads.
+     *
+     * Vyukov's algorithm: every cell of the power-of-two ring carries a sequence number
+     * telling whether it is ready to be written (equal to the enqueue position) or read
+     * (one past the dequeue position). Producers and consumers claim positions with a CAS
+     * on their own cache-line-aligned counter.
+     */
+    template<typename T>
+    class MpmcQueue
+    {
+    public:
+        MpmcQueue();
+        explicit MpmcQueue(size_t capacity);
+        MpmcQueue(const MpmcQueue& other) = delete;
+        MpmcQueue& operator=(const MpmcQueue& other) = delete;
+        ~MpmcQueue();
+
+        size_t getCapacity() const;
+        size_t size() const;
+        bool isEmpty() const;
+
+        bool tryPush(const T& element);
+        void push(const T& element);
+        bool tryPop(T& output);
+        T pop();
+
+        static const size_t INIT_CAPACITY = 1024;
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence_;
+            T data_;
+        };
+
+    private:
+        Cell* cells_;
+        size_t mask_;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePosition_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePosition_;
+    };
+
+    //----------
+
+    template<typename T>
+    SpscQueue<T>::SpscQueue() :
+        SpscQueue(INIT_CAPACITY)
+    {
+    }
+
+    template<typename T>
+    SpscQueue<T>::SpscQueue(size_t capacity) :
+        sequence_(new amt::CIS<T>(roundUpToPowerOfTwo(capacity), true)),
+        blocks_(sequence_->accessFirst()),
+        mask_(sequence_->size() - 1),
+        head_(0),
+        cachedTail_(0),
+        tail_(0),
+        cachedHead_(0)
+    {
+    }
+
+    template<typename T>
+    SpscQueue<T>::~SpscQueue()
+    {
+        delete sequence_;
+        sequence_ = nullptr;
+        blocks_ = nullptr;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::getCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::size() const
+    {
+        const size_t head = head_.load(std::memory_order_acquire);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::tryPush(const T& element)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ > mask_)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ > mask_)
+            {
+                return false;
+            }
+        }
+
+        blocks_[tail & mask_].data_ = element;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    void SpscQueue<T>::push(const T& element)
+    {
+        while (!this->tryPush(element))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::tryPop(T& output)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_)
+            {
+                return false;
+            }
+        }
+
+        output = std::move(blocks_[head & mask_].data_);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    T SpscQueue<T>::pop()
+    {
+        T result;
+        while (!this->tryPop(result))
+        {
+            std::this_thread::yield();
+        }
+        return result;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::pushBatch(const T* elements, size_t count)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (this->getCapacity() - (tail - cachedHead_) < count)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+        }
+
+        count = (std::min)(count, this->getCapacity() - (tail - cachedHead_));
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const size_t start = tail & mask_;
+        const size_t firstSpan = (std::min)(count, this->getCapacity() - start);
+        for (size_t i = 0; i < firstSpan; ++i)
+        {
+            blocks_[start + i].data_ = elements[i];
+        }
+        for (size_t i = firstSpan; i < count; ++i)
+        {
+            blocks_[i - firstSpan].data_ = elements[i];
+        }
+
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::popBatch(T* output, size_t count)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (cachedTail_ - head < count)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+
+        count = (std::min)(count, cachedTail_ - head);
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const size_t start = head & mask_;
+        const size_t firstSpan = (std::min)(count, this->getCapacity() - start);
+        for (size_t i = 0; i < firstSpan; ++i)
+        {
+            output[i] = std::move(blocks_[start + i].data_);
+        }
+        for (size_t i = firstSpan; i < count; ++i)
+        {
+            output[i] = std::move(blocks_[i - firstSpan].data_);
+        }
+
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::roundUpToPowerOfTwo(size_t n)
+    {
+        size_t result = 2;
+        while (result < n)
+        {
+            result *= 2;
+        }
+        return result;
+    }
+
+    //----------
+
+    template<typename T>
+    MpmcQueue<T>::MpmcQueue() :
+        MpmcQueue(INIT_CAPACITY)
+    {
+    }
+
+    template<typename T>
+    MpmcQueue<T>::MpmcQueue(size_t capacity) :
+        cells_(nullptr),
+        mask_(0),
+        enqueuePosition_(0),
+        dequeuePosition_(0)
+    {
+        size_t roundedCapacity = 2;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+
+        cells_ = new Cell[roundedCapacity];
+        mask_ = roundedCapacity - 1;
+
+        for (size_t i = 0; i < roundedCapacity; ++i)
+        {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template<typename T>
+    MpmcQueue<T>::~MpmcQueue()
+    {
+        delete[] cells_;
+        cells_ = nullptr;
+    }
+
+    template<typename T>
+    size_t MpmcQueue<T>::getCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+    template<typename T>
+    size_t MpmcQueue<T>::size() const
+    {
+        const size_t dequeuePosition = dequeuePosition_.load(std::memory_order_acquire);
+        const size_t enqueuePosition = enqueuePosition_.load(std::memory_order_acquire);
+        return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+    }
+
+    template<typename T>
+    bool MpmcQueue<T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename T>
+    bool MpmcQueue<T>::tryPush(const T& element)
+    {
+        Cell* cell;
+        size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence_.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+            if (difference == 0)
+            {
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data_ = element;
+        cell->sequence_.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    void MpmcQueue<T>::push(const T& element)
+    {
+        while (!this->tryPush(element))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    bool MpmcQueue<T>::tryPop(T& output)
+    {
+        Cell* cell;
+        size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence_.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (dequeuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = dequeuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        output = std::move(cell->data_);
+        cell->sequence_.store(position + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    T MpmcQueue<T>::pop()
+    {
+        T result;
+        while (!this->tryPop(result))
+        {
+            std::this_thread::yield();
+        }
+        return result;
+    }
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::adt {
+
+    /**
+     * @brief Lock-free (Treiber) stack for any number of threads.
+     *
+     * Popped nodes are never deleted while the stack lives. They are recycled through
+     * a second Treiber stack of free nodes, so a thread that lost a race may still
+     * safely read the link of a node it no longer owns. The ABA problem is avoided by
+     * tagging every top pointer with a counter that is incremented on each change.
+     * The tag occupies the bits of a 64-bit word not used by user-space addresses
+     * (the upper 16 bits on 64-bit platforms), so the top stays a lock-free atomic.
+     */
+    template<typename T>
+    class ConcurrentStack
+    {
+    public:
+        ConcurrentStack();
+        ConcurrentStack(const ConcurrentStack& other) = delete;
+        ConcurrentStack& operator=(const ConcurrentStack& other) = delete;
+        ~ConcurrentStack();
+
+        size_t size() const;
+        bool isEmpty() const;
+
+        void push(T element);
+        bool tryPop(T& output);
+        T pop();
+
+    private:
+        struct Node :
+            public amt::MemoryBlock<T>
+        {
+            std::atomic<Node*> next_{ nullptr };
+        };
+
+        using TaggedPointer = std::uint64_t;
+
+        static const unsigned POINTER_BITS = sizeof(void*) == 4 ? 32 : 48;
+        static const TaggedPointer POINTER_MASK = (TaggedPointer(1) << POINTER_BITS) - 1;
+
+        static Node* getPointer(TaggedPointer tagged);
+        static TaggedPointer makeTagged(Node* pointer, TaggedPointer previous);
+
+        static void pushNode(std::atomic<TaggedPointer>& top, Node* node);
+        static Node* popNode(std::atomic<TaggedPointer>& top);
+        static void deleteNodes(std::atomic<TaggedPointer>& top);
+
+    private:
+        std::atomic<TaggedPointer> top_;
+        std::atomic<TaggedPointer> free_;
+        std::atomic<size_t> size_;
+    };
+
+    //----------
+
+    template<typename T>
+    ConcurrentStack<T>::ConcurrentStack() :
+        top_(0),
+        free_(0),
+        size_(0)
+    {
+    }
+
+    template<typename T>
+    ConcurrentStack<T>::~ConcurrentStack()
+    {
+        deleteNodes(top_);
+        deleteNodes(free_);
+        size_ = 0;
+    }
+
+    template<typename T>
+    size_t ConcurrentStack<T>::size() const
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    bool ConcurrentStack<T>::isEmpty() const
+    {
+        return getPointer(top_.load(std::memory_order_acquire)) == nullptr;
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::push(T element)
+    {
+        Node* node = popNode(free_);
+        if (node == nullptr)
+        {
+            node = new Node();
+        }
+
+        node->data_ = std::move(element);
+        pushNode(top_, node);
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    bool ConcurrentStack<T>::tryPop(T& output)
+    {
+        Node* node = popNode(top_);
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        output = std::move(node->data_);
+        pushNode(free_, node);
+        return true;
+    }
+
+    template<typename T>
+    T ConcurrentStack<T>::pop()
+    {
+        T result;
+        if (!this->tryPop(result))
+        {
+            throw std::out_of_range("Stack is empty!");
+        }
+        return result;
+    }
+
+    template<typename T>
+    typename ConcurrentStack<T>::Node* ConcurrentStack<T>::getPointer(TaggedPointer tagged)
+    {
+        return reinterpret_cast<Node*>(static_cast<std::uintptr_t>(tagged & POINTER_MASK));
+    }
+
+    template<typename T>
+    typename ConcurrentStack<T>::TaggedPointer ConcurrentStack<T>::makeTagged(Node* pointer, TaggedPointer previous)
+    {
+        const TaggedPointer tag = (previous >> POINTER_BITS) + 1;
+        return (tag << POINTER_BITS) | (static_cast<TaggedPointer>(reinterpret_cast<std::uintptr_t>(pointer)) & POINTER_MASK);
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::pushNode(std::atomic<TaggedPointer>& top, Node* node)
+    {
+        TaggedPointer oldTop = top.load(std::memory_order_relaxed);
+        do
+        {
+            node->next_.store(getPointer(oldTop), std::memory_order_relaxed);
+        }
+        while (!top.compare_exchange_weak(oldTop, makeTagged(node, oldTop), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    template<typename T>
+    typename ConcurrentStack<T>::Node* ConcurrentStack<T>::popNode(std::atomic<TaggedPointer>& top)
+    {
+        TaggedPointer oldTop = top.load(std::memory_order_acquire);
+        Node* node = getPointer(oldTop);
+        while (node != nullptr)
+        {
+            // The node may be popped and recycled meanwhile; its memory stays valid and the tag detects the change.
+            Node* next = node->next_.load(std::memory_order_relaxed);
+            if (top.compare_exchange_weak(oldTop, makeTagged(next, oldTop), std::memory_order_acquire, std::memory_order_acquire))
+            {
+                break;
+            }
+            node = getPointer(oldTop);
+        }
+        return node;
+    }
+
+    template<typename T>
+    void ConcurrentStack<T>::deleteNodes(std::atomic<TaggedPointer>& top)
+    {
+        Node* node = getPointer(top.load(std::memory_order_relaxed));
+        while (node != nullptr)
+        {
+            Node* next = node->next_.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+        top.store(0, std::memory_order_relaxed);
+    }
+}
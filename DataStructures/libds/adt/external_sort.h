@@ -0,0 +1,519 @@
+#pragma once
+
+#include <libds/adt/priority_queue.h>
+#include <libds/adt/sorts.h>
+#include <libds/amt/implicit_sequence.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ds::adt
+{
+    /**
+     * @brief Sizes and durations of the phases of the last external sort.
+     */
+    struct ExternalSortStatistics
+    {
+        size_t recordCount_ = 0;
+        size_t runCount_ = 0;
+        size_t mergePassCount_ = 0;
+        size_t bytesRead_ = 0;
+        size_t bytesWritten_ = 0;
+        double ioSeconds_ = 0;
+        double sortSeconds_ = 0;
+        double mergeSeconds_ = 0;
+
+        /**
+         * @brief Returns megabytes read and written per second spent in file operations.
+         */
+        double getIoThroughput() const;
+
+        /**
+         * @brief Returns records per second sorted in memory while runs were created.
+         */
+        double getSortThroughput() const;
+
+        /**
+         * @brief Returns records per second passed through the merge heap, over all passes.
+         * Includes reading and writing of the merged runs.
+         */
+        double getMergeThroughput() const;
+
+        std::string toString() const;
+    };
+
+    //----------
+
+    /**
+     * @brief Sorts a file of fixed-size records that may not fit into memory.
+     *
+     * Runs of as many records as the memory budget allows are sorted by IntroSort and
+     * written to temporary files. The runs are then merged by a BinaryHeap of run heads,
+     * each run being read through its own buffer. When there are more runs than buffers
+     * of MIN_RUN_BUFFER_SIZE fit into the budget, they are merged in several passes.
+     * The sort is not stable.
+     */
+    template <typename T>
+    class ExternalSort
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Records are stored in files as raw bytes.");
+
+    public:
+        ExternalSort();
+        ExternalSort(size_t memoryBudget, const std::filesystem::path& tempDirectory);
+
+        void setMemoryBudget(size_t memoryBudget);
+        void setTempDirectory(const std::filesystem::path& tempDirectory);
+        const ExternalSortStatistics& getStatistics() const;
+
+        /**
+         * @brief Writes records of @p input to @p output ordered by @p compare.
+         */
+        template<typename Compare = std::less<T>>
+        void sort(const std::filesystem::path& input, const std::filesystem::path& output, Compare compare = Compare());
+
+        static const size_t DEFAULT_MEMORY_BUDGET = static_cast<size_t>(64) << 20;
+        static const size_t MIN_RUN_BUFFER_SIZE = static_cast<size_t>(64) << 10;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Reads records of a run through a buffer of fixed capacity.
+         */
+        class RunReader
+        {
+        public:
+            RunReader(const std::filesystem::path& path, size_t capacity, ExternalSortStatistics& statistics);
+
+            bool isExhausted() const;
+            const T& current() const;
+            void advance();
+
+        private:
+            void refill();
+
+        private:
+            std::ifstream stream_;
+            std::vector<T> buffer_;
+            size_t position_;
+            size_t count_;
+            ExternalSortStatistics& statistics_;
+        };
+
+        /**
+         * @brief Writes records through a buffer of fixed capacity.
+         */
+        class RunWriter
+        {
+        public:
+            RunWriter(const std::filesystem::path& path, size_t capacity, ExternalSortStatistics& statistics);
+
+            void push(const T& record);
+            void write(const T* records, size_t count);
+            void flush();
+
+        private:
+            std::ofstream stream_;
+            std::vector<T> buffer_;
+            ExternalSortStatistics& statistics_;
+        };
+
+        /**
+         * @brief Priority of a run in the merge heap, its current record; ties go to the lower run.
+         */
+        template<typename Compare>
+        struct RunHead
+        {
+            const T* record_;
+            size_t run_;
+            Compare* compare_;
+
+            bool operator<(const RunHead& other) const
+            {
+                return (*compare_)(*record_, *other.record_) || (!(*compare_)(*other.record_, *record_) && run_ < other.run_);
+            }
+
+            bool operator>(const RunHead& other) const
+            {
+                return other < *this;
+            }
+
+            bool operator==(const RunHead& other) const
+            {
+                return record_ == other.record_ && run_ == other.run_;
+            }
+        };
+
+        template<typename Compare>
+        std::vector<std::filesystem::path> createRuns(std::ifstream& input, const std::filesystem::path& output, Compare& compare);
+
+        template<typename Compare>
+        void mergeRuns(const std::vector<std::filesystem::path>& runs, size_t begin, size_t end, const std::filesystem::path& output, Compare& compare);
+
+        std::filesystem::path createRunPath();
+        void removeRuns();
+        size_t getFanIn() const;
+
+        static double secondsSince(Clock::time_point start);
+
+    private:
+        size_t memoryBudget_;
+        std::filesystem::path tempDirectory_;
+        ExternalSortStatistics statistics_;
+        std::string sessionName_;
+        std::vector<std::filesystem::path> createdRuns_;
+    };
+
+    //----------
+
+    inline double ExternalSortStatistics::getIoThroughput() const
+    {
+        return ioSeconds_ > 0 ? static_cast<double>(bytesRead_ + bytesWritten_) / (1 << 20) / ioSeconds_ : 0;
+    }
+
+    inline double ExternalSortStatistics::getSortThroughput() const
+    {
+        return sortSeconds_ > 0 ? static_cast<double>(recordCount_) / sortSeconds_ : 0;
+    }
+
+    inline double ExternalSortStatistics::getMergeThroughput() const
+    {
+        return mergeSeconds_ > 0 ? static_cast<double>(recordCount_ * mergePassCount_) / mergeSeconds_ : 0;
+    }
+
+    inline std::string ExternalSortStatistics::toString() const
+    {
+        std::ostringstream result;
+        result << "records: " << recordCount_ << ", runs: " << runCount_ << ", merge passes: " << mergePassCount_ << "\n"
+            << "I/O: " << (bytesRead_ + bytesWritten_) / (1 << 20) << " MB in " << ioSeconds_ << " s, " << this->getIoThroughput() << " MB/s\n"
+            << "run sort: " << sortSeconds_ << " s, " << this->getSortThroughput() << " records/s\n"
+            << "merge: " << mergeSeconds_ << " s, " << this->getMergeThroughput() << " records/s\n";
+        return result.str();
+    }
+
+    //----------
+
+    template<typename T>
+    ExternalSort<T>::RunReader::RunReader(const std::filesystem::path& path, size_t capacity, ExternalSortStatistics& statistics) :
+        stream_(path, std::ios::binary),
+        buffer_(capacity),
+        position_(0),
+        count_(0),
+        statistics_(statistics)
+    {
+        if (!stream_)
+        {
+            throw std::runtime_error("Cannot open run " + path.string() + "!");
+        }
+        this->refill();
+    }
+
+    template<typename T>
+    bool ExternalSort<T>::RunReader::isExhausted() const
+    {
+        return position_ == count_;
+    }
+
+    template<typename T>
+    const T& ExternalSort<T>::RunReader::current() const
+    {
+        return buffer_[position_];
+    }
+
+    template<typename T>
+    void ExternalSort<T>::RunReader::advance()
+    {
+        if (++position_ == count_)
+        {
+            this->refill();
+        }
+    }
+
+    template<typename T>
+    void ExternalSort<T>::RunReader::refill()
+    {
+        const Clock::time_point start = Clock::now();
+        stream_.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size() * sizeof(T)));
+        const size_t bytes = static_cast<size_t>(stream_.gcount());
+        statistics_.ioSeconds_ += secondsSince(start);
+        statistics_.bytesRead_ += bytes;
+
+        position_ = 0;
+        count_ = bytes / sizeof(T);
+    }
+
+    //----------
+
+    template<typename T>
+    ExternalSort<T>::RunWriter::RunWriter(const std::filesystem::path& path, size_t capacity, ExternalSortStatistics& statistics) :
+        stream_(path, std::ios::binary | std::ios::trunc),
+        statistics_(statistics)
+    {
+        if (!stream_)
+        {
+            throw std::runtime_error("Cannot create " + path.string() + "!");
+        }
+        buffer_.reserve(capacity);
+    }
+
+    template<typename T>
+    void ExternalSort<T>::RunWriter::push(const T& record)
+    {
+        buffer_.push_back(record);
+        if (buffer_.size() == buffer_.capacity())
+        {
+            this->flush();
+        }
+    }
+
+    template<typename T>
+    void ExternalSort<T>::RunWriter::write(const T* records, size_t count)
+    {
+        const Clock::time_point start = Clock::now();
+        stream_.write(reinterpret_cast<const char*>(records), static_cast<std::streamsize>(count * sizeof(T)));
+        if (!stream_)
+        {
+            throw std::runtime_error("Cannot write records!");
+        }
+        statistics_.ioSeconds_ += secondsSince(start);
+        statistics_.bytesWritten_ += count * sizeof(T);
+    }
+
+    template<typename T>
+    void ExternalSort<T>::RunWriter::flush()
+    {
+        this->write(buffer_.data(), buffer_.size());
+        buffer_.clear();
+
+        const Clock::time_point start = Clock::now();
+        stream_.flush();
+        statistics_.ioSeconds_ += secondsSince(start);
+    }
+
+    //----------
+
+    template<typename T>
+    ExternalSort<T>::ExternalSort() :
+        ExternalSort(DEFAULT_MEMORY_BUDGET, std::filesystem::temp_directory_path())
+    {
+    }
+
+    template<typename T>
+    ExternalSort<T>::ExternalSort(size_t memoryBudget, const std::filesystem::path& tempDirectory) :
+        memoryBudget_(memoryBudget),
+        tempDirectory_(tempDirectory)
+    {
+    }
+
+    template<typename T>
+    void ExternalSort<T>::setMemoryBudget(size_t memoryBudget)
+    {
+        memoryBudget_ = memoryBudget;
+    }
+
+    template<typename T>
+    void ExternalSort<T>::setTempDirectory(const std::filesystem::path& tempDirectory)
+    {
+        tempDirectory_ = tempDirectory;
+    }
+
+    template<typename T>
+    const ExternalSortStatistics& ExternalSort<T>::getStatistics() const
+    {
+        return statistics_;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ExternalSort<T>::sort(const std::filesystem::path& input, const std::filesystem::path& output, Compare compare)
+    {
+        statistics_ = ExternalSortStatistics();
+        sessionName_ = "ds-external-sort-" + std::to_string(std::random_device()());
+
+        std::ifstream inputStream(input, std::ios::binary);
+        if (!inputStream)
+        {
+            throw std::runtime_error("Cannot open " + input.string() + "!");
+        }
+
+        try
+        {
+            std::vector<std::filesystem::path> runs = this->createRuns(inputStream, output, compare);
+            inputStream.close();
+
+            // Each pass merges groups of runs that fit into the budget, the last one writes the output.
+            const size_t fanIn = this->getFanIn();
+            while (runs.size() > fanIn)
+            {
+                std::vector<std::filesystem::path> mergedRuns;
+                for (size_t begin = 0; begin < runs.size(); begin += fanIn)
+                {
+                    const size_t end = (std::min)(begin + fanIn, runs.size());
+                    if (end - begin == 1)
+                    {
+                        mergedRuns.push_back(runs[begin]);
+                    }
+                    else
+                    {
+                        mergedRuns.push_back(this->createRunPath());
+                        this->mergeRuns(runs, begin, end, mergedRuns.back(), compare);
+                    }
+                }
+                runs = std::move(mergedRuns);
+                ++statistics_.mergePassCount_;
+            }
+
+            if (!runs.empty())
+            {
+                this->mergeRuns(runs, 0, runs.size(), output, compare);
+                ++statistics_.mergePassCount_;
+            }
+        }
+        catch (...)
+        {
+            this->removeRuns();
+            throw;
+        }
+
+        this->removeRuns();
+    }
+
+    template<typename T>
+    template<typename Compare>
+    std::vector<std::filesystem::path> ExternalSort<T>::createRuns(std::ifstream& input, const std::filesystem::path& output, Compare& compare)
+    {
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+        static_assert(sizeof(BlockType) == sizeof(T), "Records are read directly into the blocks.");
+
+        const size_t runCapacity = (std::max)(memoryBudget_ / sizeof(T), static_cast<size_t>(1));
+        amt::ImplicitSequence<T> run(runCapacity, true);
+        run.makeContiguous();
+        BlockType* blocks = run.accessFirst();
+
+        std::vector<std::filesystem::path> runs;
+        for (;;)
+        {
+            Clock::time_point start = Clock::now();
+            input.read(reinterpret_cast<char*>(blocks), static_cast<std::streamsize>(runCapacity * sizeof(T)));
+            const size_t bytes = static_cast<size_t>(input.gcount());
+            statistics_.ioSeconds_ += secondsSince(start);
+            statistics_.bytesRead_ += bytes;
+
+            if (bytes % sizeof(T) != 0)
+            {
+                throw std::runtime_error("Input size is not a multiple of the record size!");
+            }
+
+            const size_t count = bytes / sizeof(T);
+            const bool isLast = !input;
+            if (count == 0 && !runs.empty())
+            {
+                return runs;
+            }
+
+            start = Clock::now();
+            IntroSort<T>::sortRange(blocks, count, compare);
+            statistics_.sortSeconds_ += secondsSince(start);
+            statistics_.recordCount_ += count;
+            ++statistics_.runCount_;
+
+            // Input that fits into a single run is written to the output directly.
+            if (isLast && runs.empty())
+            {
+                RunWriter(output, 0, statistics_).write(&blocks->data_, count);
+                return runs;
+            }
+
+            runs.push_back(this->createRunPath());
+            RunWriter(runs.back(), 0, statistics_).write(&blocks->data_, count);
+
+            if (isLast)
+            {
+                return runs;
+            }
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ExternalSort<T>::mergeRuns(const std::vector<std::filesystem::path>& runs, size_t begin, size_t end, const std::filesystem::path& output, Compare& compare)
+    {
+        const Clock::time_point start = Clock::now();
+
+        // The budget is shared by the buffers of all runs and of the output.
+        const size_t bufferCapacity = (std::max)(memoryBudget_ / (end - begin + 1) / sizeof(T), static_cast<size_t>(1));
+
+        std::vector<std::unique_ptr<RunReader>> readers;
+        BinaryHeap<RunHead<Compare>, size_t> heap;
+        for (size_t i = begin; i < end; ++i)
+        {
+            readers.push_back(std::make_unique<RunReader>(runs[i], bufferCapacity, statistics_));
+            if (!readers.back()->isExhausted())
+            {
+                heap.push({ &readers.back()->current(), readers.size() - 1, &compare }, readers.size() - 1);
+            }
+        }
+
+        RunWriter writer(output, bufferCapacity, statistics_);
+        while (!heap.isEmpty())
+        {
+            const size_t run = heap.pop();
+            RunReader& reader = *readers[run];
+            writer.push(reader.current());
+            reader.advance();
+            if (!reader.isExhausted())
+            {
+                heap.push({ &reader.current(), run, &compare }, run);
+            }
+        }
+        writer.flush();
+
+        readers.clear();
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::filesystem::remove(runs[i]);
+        }
+
+        statistics_.mergeSeconds_ += secondsSince(start);
+    }
+
+    template<typename T>
+    std::filesystem::path ExternalSort<T>::createRunPath()
+    {
+        createdRuns_.push_back(tempDirectory_ / (sessionName_ + "-" + std::to_string(createdRuns_.size()) + ".run"));
+        return createdRuns_.back();
+    }
+
+    template<typename T>
+    void ExternalSort<T>::removeRuns()
+    {
+        for (const std::filesystem::path& run : createdRuns_)
+        {
+            std::error_code error;
+            std::filesystem::remove(run, error);
+        }
+        createdRuns_.clear();
+    }
+
+    template<typename T>
+    size_t ExternalSort<T>::getFanIn() const
+    {
+        return (std::max)(memoryBudget_ / MIN_RUN_BUFFER_SIZE, static_cast<size_t>(3)) - 1;
+    }
+
+    template<typename T>
+    double ExternalSort<T>::secondsSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+}
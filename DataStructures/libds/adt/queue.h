@@ -3,6 +3,8 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <algorithm>
+#include <utility>
 
 namespace ds::adt {
 
@@ -18,6 +20,13 @@ namespace ds::adt {
 
     //----------
 
+    /**
+     * @brief Queue stored in a ring of blocks of a cyclic implicit sequence.
+     *
+     * When the ring is full, it is relinearized into a twice as large ring
+     * (front of the queue at index 0). If created with shrinkWhenSparse,
+     * the ring is halved once it is at most a quarter full.
+     */
     template<typename T>
     class ImplicitQueue :
         public Queue<T>,
@@ -27,8 +36,11 @@ namespace ds::adt {
         ImplicitQueue();
         ImplicitQueue(const ImplicitQueue& other);
         ImplicitQueue(size_t capacity);
+        ImplicitQueue(size_t capacity, bool shrinkWhenSparse);
 
         size_t getCapacity() const;
+        void reserveCapacity(size_t capacity);
+        void shrinkToFit();
 
         ADT& assign(const ADT& other) override;
         void clear() override;
@@ -39,15 +51,33 @@ namespace ds::adt {
         T& peek() override;
         T pop() override;
 
+        /**
+         * @brief Pushes @p count elements from @p elements, copying at most two contiguous spans.
+         */
+        void pushBatch(const T* elements, size_t count);
+
+        /**
+         * @brief Pops up to @p count elements into @p output, moving at most two contiguous spans.
+         * @return Number of popped elements.
+         */
+        size_t popBatch(T* output, size_t count);
+
         static const int INIT_CAPACITY = 100;
 
     private:
+        using BlockType = typename amt::CIS<T>::BlockType;
+
         amt::CIS<T>* getSequence() const;
+        BlockType* getBlocks() const;
+        void ensureCapacity(size_t requiredCapacity);
+        void shrinkIfSparse();
+        void relocate(size_t newCapacity);
 
     private:
         size_t insertionIndex_;
         size_t removalIndex_;
         size_t size_;
+        bool shrinkWhenSparse_;
     };
 
     //----------
@@ -70,6 +100,81 @@ namespace ds::adt {
 
     //----------
 
+    /**
+     * @brief Queue stored in a singly linked list of chunks, each holding up to ChunkCapacity elements.
+     *
+     * Elements are pushed to the last chunk and popped from the first one, so there is
+     * one allocation per chunk instead of one per element. Emptied chunks are kept in
+     * a small free list and reused by later pushes.
+     */
+    template<typename T, size_t ChunkCapacity = 128>
+    class UnrolledQueue :
+        public Queue<T>,
+        public ADS<T>
+    {
+    public:
+        UnrolledQueue();
+        UnrolledQueue(const UnrolledQueue& other);
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool equals(const ADT& other) override;
+
+        void push(T element) override;
+        T& peek() override;
+        T pop() override;
+
+        size_t getChunkCount() const;
+
+        static const size_t MAX_FREE_CHUNKS = 2;
+
+    private:
+        struct Chunk
+        {
+            T elements_[ChunkCapacity];
+
+            bool operator==(const Chunk& other) const
+            {
+                return std::equal(elements_, elements_ + ChunkCapacity, other.elements_);
+            }
+        };
+
+        using SequenceType = amt::SinglyLS<Chunk>;
+        using BlockType = typename SequenceType::BlockType;
+
+        /**
+         * @brief Memory manager keeping up to MAX_FREE_CHUNKS released blocks for reuse.
+         */
+        class ChunkMemoryManager :
+            public mm::MemoryManager<BlockType>
+        {
+        public:
+            ~ChunkMemoryManager() override;
+            BlockType* allocateMemory() override;
+            void releaseMemory(BlockType* pointer) override;
+            size_t getAllocatedCapacitySize() const override;
+            mm::MemoryManager<BlockType>* createEmpty(size_t blockCount) const override;
+
+        private:
+            BlockType* freeChunks_ = nullptr;
+            size_t freeChunkCount_ = 0;
+        };
+
+    private:
+        SequenceType* getSequence() const;
+
+        template<typename Operation>
+        void processAllElements(Operation operation) const;
+
+    private:
+        size_t size_;
+        size_t firstIndex_;
+        size_t lastEnd_;
+    };
+
+    //----------
+
     template<typename T>
     ImplicitQueue<T>::ImplicitQueue():
         ImplicitQueue(INIT_CAPACITY)
@@ -78,10 +183,27 @@ namespace ds::adt {
 
     template<typename T>
     ImplicitQueue<T>::ImplicitQueue(size_t capacity) :
+        ImplicitQueue(capacity, false)
+    {
+    }
+
+    template<typename T>
+    ImplicitQueue<T>::ImplicitQueue(size_t capacity, bool shrinkWhenSparse) :
         ADS<T>(new amt::CIS<T>(capacity, true)),
         insertionIndex_(0),
         removalIndex_(0),
-        size_(0)
+        size_(0),
+        shrinkWhenSparse_(shrinkWhenSparse)
+    {
+    }
+
+    template<typename T>
+    ImplicitQueue<T>::ImplicitQueue(const ImplicitQueue& other) :
+        ADS<T>(new amt::CIS<T>(), other),
+        insertionIndex_(other.insertionIndex_),
+        removalIndex_(other.removalIndex_),
+        size_(other.size_),
+        shrinkWhenSparse_(other.shrinkWhenSparse_)
     {
     }
 
@@ -92,20 +214,31 @@ namespace ds::adt {
     }
 
     template<typename T>
-    ImplicitQueue<T>::ImplicitQueue(const ImplicitQueue& other) :
-        ADS<T>(new amt::CIS<T>(), other),
-        insertionIndex_(other.insertionIndex_),
-        removalIndex_(other.removalIndex_),
-        size_(other.size_)
+    void ImplicitQueue<T>::reserveCapacity(size_t capacity)
+    {
+        this->ensureCapacity(capacity);
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::shrinkToFit()
     {
+        this->relocate(size_);
     }
 
     template<typename T>
     ADT& ImplicitQueue<T>::assign(const ADT& other)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this != &other)
+        {
+            const ImplicitQueue<T>& otherQueue = dynamic_cast<const ImplicitQueue<T>&>(other);
+            ADS<T>::assign(otherQueue);
+            insertionIndex_ = otherQueue.insertionIndex_;
+            removalIndex_ = otherQueue.removalIndex_;
+            size_ = otherQueue.size_;
+            shrinkWhenSparse_ = otherQueue.shrinkWhenSparse_;
+        }
+
+        return *this;
     }
 
     template<typename T>
@@ -124,33 +257,126 @@ namespace ds::adt {
     template<typename T>
     bool ImplicitQueue<T>::equals(const ADT& other)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const ImplicitQueue<T>* otherQueue = dynamic_cast<const ImplicitQueue<T>*>(&other);
+        if (otherQueue == nullptr || size_ != otherQueue->size_)
+        {
+            return false;
+        }
+
+        size_t myIndex = removalIndex_;
+        size_t otherIndex = otherQueue->removalIndex_;
+        for (size_t i = 0; i < size_; ++i)
+        {
+            if (!(this->getSequence()->access(myIndex)->data_ == otherQueue->getSequence()->access(otherIndex)->data_))
+            {
+                return false;
+            }
+
+            myIndex = this->getSequence()->indexOfNext(myIndex);
+            otherIndex = otherQueue->getSequence()->indexOfNext(otherIndex);
+        }
+
+        return true;
     }
 
     template<typename T>
     void ImplicitQueue<T>::push(T element)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        this->ensureCapacity(size_ + 1);
+        this->getSequence()->access(insertionIndex_)->data_ = std::move(element);
+        insertionIndex_ = this->getSequence()->indexOfNext(insertionIndex_);
+        ++size_;
     }
 
     template<typename T>
     T& ImplicitQueue<T>::peek()
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        return this->getSequence()->access(removalIndex_)->data_;
     }
 
     template<typename T>
     T ImplicitQueue<T>::pop()
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        T result = std::move(this->getSequence()->access(removalIndex_)->data_);
+        removalIndex_ = this->getSequence()->indexOfNext(removalIndex_);
+        --size_;
+
+        this->shrinkIfSparse();
+
+        return result;
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::pushBatch(const T* elements, size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        this->ensureCapacity(size_ + count);
+
+        const size_t capacity = this->getCapacity();
+        const size_t firstSpan = (std::min)(count, capacity - insertionIndex_);
+        BlockType* blocks = this->getBlocks();
+
+        for (size_t i = 0; i < firstSpan; ++i)
+        {
+            blocks[insertionIndex_ + i].data_ = elements[i];
+        }
+
+        for (size_t i = firstSpan; i < count; ++i)
+        {
+            blocks[i - firstSpan].data_ = elements[i];
+        }
+
+        insertionIndex_ = (insertionIndex_ + count) % capacity;
+        size_ += count;
+    }
+
+    template<typename T>
+    size_t ImplicitQueue<T>::popBatch(T* output, size_t count)
+    {
+        count = (std::min)(count, size_);
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const size_t capacity = this->getCapacity();
+        const size_t firstSpan = (std::min)(count, capacity - removalIndex_);
+        BlockType* blocks = this->getBlocks();
+
+        for (size_t i = 0; i < firstSpan; ++i)
+        {
+            output[i] = std::move(blocks[removalIndex_ + i].data_);
+        }
+
+        for (size_t i = firstSpan; i < count; ++i)
+        {
+            output[i] = std::move(blocks[i - firstSpan].data_);
+        }
+
+        removalIndex_ = (removalIndex_ + count) % capacity;
+        size_ -= count;
+        this->shrinkIfSparse();
+
+        return count;
     }
 
     template<typename T>
@@ -159,6 +385,68 @@ namespace ds::adt {
         return dynamic_cast<amt::CIS<T>*>(this->memoryStructure_);
     }
 
+    template<typename T>
+    typename ImplicitQueue<T>::BlockType* ImplicitQueue<T>::getBlocks() const
+    {
+        // Blocks of an implicit sequence are stored contiguously.
+        return this->getSequence()->accessFirst();
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::ensureCapacity(size_t requiredCapacity)
+    {
+        size_t newCapacity = this->getCapacity();
+        if (newCapacity >= requiredCapacity)
+        {
+            return;
+        }
+
+        if (newCapacity == 0)
+        {
+            newCapacity = INIT_CAPACITY;
+        }
+
+        while (newCapacity < requiredCapacity)
+        {
+            newCapacity *= 2;
+        }
+
+        this->relocate(newCapacity);
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::shrinkIfSparse()
+    {
+        const size_t capacity = this->getCapacity();
+        if (shrinkWhenSparse_ && size_ <= capacity / 4 && capacity / 2 >= static_cast<size_t>(INIT_CAPACITY))
+        {
+            this->relocate(capacity / 2);
+        }
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::relocate(size_t newCapacity)
+    {
+        amt::CIS<T>* newSequence = new amt::CIS<T>(newCapacity, true);
+
+        if (size_ > 0)
+        {
+            // The ring is moved as (at most) two contiguous spans so that the front ends up at index 0.
+            BlockType* source = this->getBlocks();
+            BlockType* target = newSequence->accessFirst();
+            const size_t firstSpan = (std::min)(size_, this->getCapacity() - removalIndex_);
+
+            std::move(source + removalIndex_, source + removalIndex_ + firstSpan, target);
+            std::move(source, source + (size_ - firstSpan), target + firstSpan);
+        }
+
+        delete this->memoryStructure_;
+        this->memoryStructure_ = newSequence;
+
+        removalIndex_ = 0;
+        insertionIndex_ = newCapacity > 0 ? size_ % newCapacity : 0;
+    }
+
     template<typename T>
     ExplicitQueue<T>::ExplicitQueue() :
         ADS<T>(new amt::SinglyLS<T>())
@@ -200,4 +488,222 @@ namespace ds::adt {
     {
         return dynamic_cast<amt::SinglyLS<T>*>(this->memoryStructure_);
     }
+
+    template<typename T, size_t ChunkCapacity>
+    UnrolledQueue<T, ChunkCapacity>::UnrolledQueue() :
+        ADS<T>(new SequenceType(new ChunkMemoryManager())),
+        size_(0),
+        firstIndex_(0),
+        lastEnd_(0)
+    {
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    UnrolledQueue<T, ChunkCapacity>::UnrolledQueue(const UnrolledQueue& other) :
+        UnrolledQueue()
+    {
+        this->assign(other);
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    ADT& UnrolledQueue<T, ChunkCapacity>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const UnrolledQueue& otherQueue = dynamic_cast<const UnrolledQueue&>(other);
+            this->clear();
+            otherQueue.processAllElements([this](const T& element)
+                {
+                    this->push(element);
+                });
+        }
+
+        return *this;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    void UnrolledQueue<T, ChunkCapacity>::clear()
+    {
+        this->getSequence()->clear();
+        size_ = 0;
+        firstIndex_ = 0;
+        lastEnd_ = 0;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    size_t UnrolledQueue<T, ChunkCapacity>::size() const
+    {
+        return size_;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    bool UnrolledQueue<T, ChunkCapacity>::equals(const ADT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const UnrolledQueue* otherQueue = dynamic_cast<const UnrolledQueue*>(&other);
+        if (otherQueue == nullptr || size_ != otherQueue->size_)
+        {
+            return false;
+        }
+
+        // Both queues keep the same number of elements, but each may start at a different chunk offset.
+        BlockType* otherChunk = otherQueue->getSequence()->accessFirst();
+        size_t otherIndex = otherQueue->firstIndex_;
+        bool result = true;
+        this->processAllElements([&](const T& element)
+            {
+                if (otherIndex == ChunkCapacity)
+                {
+                    otherChunk = otherChunk->next_;
+                    otherIndex = 0;
+                }
+                result = result && element == otherChunk->data_.elements_[otherIndex];
+                ++otherIndex;
+            });
+        return result;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    void UnrolledQueue<T, ChunkCapacity>::push(T element)
+    {
+        SequenceType* sequence = this->getSequence();
+        if (sequence->isEmpty() || lastEnd_ == ChunkCapacity)
+        {
+            sequence->insertLast();
+            lastEnd_ = 0;
+        }
+
+        sequence->accessLast()->data_.elements_[lastEnd_] = std::move(element);
+        ++lastEnd_;
+        ++size_;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    T& UnrolledQueue<T, ChunkCapacity>::peek()
+    {
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        return this->getSequence()->accessFirst()->data_.elements_[firstIndex_];
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    T UnrolledQueue<T, ChunkCapacity>::pop()
+    {
+        if (size_ == 0)
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        SequenceType* sequence = this->getSequence();
+        T result = std::move(sequence->accessFirst()->data_.elements_[firstIndex_]);
+        ++firstIndex_;
+        --size_;
+
+        if (size_ == 0)
+        {
+            // The last element was in the only chunk, which is kept and refilled from its beginning.
+            firstIndex_ = 0;
+            lastEnd_ = 0;
+        }
+        else if (firstIndex_ == ChunkCapacity)
+        {
+            sequence->removeFirst();
+            firstIndex_ = 0;
+        }
+
+        return result;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    size_t UnrolledQueue<T, ChunkCapacity>::getChunkCount() const
+    {
+        return this->getSequence()->size();
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    auto UnrolledQueue<T, ChunkCapacity>::getSequence() const -> SequenceType*
+    {
+        return dynamic_cast<SequenceType*>(this->memoryStructure_);
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    template<typename Operation>
+    void UnrolledQueue<T, ChunkCapacity>::processAllElements(Operation operation) const
+    {
+        BlockType* chunk = this->getSequence()->accessFirst();
+        size_t index = firstIndex_;
+        for (size_t i = 0; i < size_; ++i)
+        {
+            if (index == ChunkCapacity)
+            {
+                chunk = chunk->next_;
+                index = 0;
+            }
+            operation(chunk->data_.elements_[index]);
+            ++index;
+        }
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    UnrolledQueue<T, ChunkCapacity>::ChunkMemoryManager::~ChunkMemoryManager()
+    {
+        while (freeChunks_ != nullptr)
+        {
+            BlockType* next = static_cast<BlockType*>(freeChunks_->next_);
+            delete freeChunks_;
+            freeChunks_ = next;
+        }
+        freeChunkCount_ = 0;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    auto UnrolledQueue<T, ChunkCapacity>::ChunkMemoryManager::allocateMemory() -> BlockType*
+    {
+        if (freeChunks_ == nullptr)
+        {
+            return mm::MemoryManager<BlockType>::allocateMemory();
+        }
+
+        BlockType* result = freeChunks_;
+        freeChunks_ = static_cast<BlockType*>(result->next_);
+        result->next_ = nullptr;
+        --freeChunkCount_;
+        this->countAllocations();
+        return result;
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    void UnrolledQueue<T, ChunkCapacity>::ChunkMemoryManager::releaseMemory(BlockType* pointer)
+    {
+        if (freeChunkCount_ == MAX_FREE_CHUNKS)
+        {
+            mm::MemoryManager<BlockType>::releaseMemory(pointer);
+            return;
+        }
+
+        pointer->next_ = freeChunks_;
+        freeChunks_ = pointer;
+        ++freeChunkCount_;
+        this->countReleases();
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    size_t UnrolledQueue<T, ChunkCapacity>::ChunkMemoryManager::getAllocatedCapacitySize() const
+    {
+        return (this->getAllocatedBlockCount() + freeChunkCount_) * sizeof(BlockType);
+    }
+
+    template<typename T, size_t ChunkCapacity>
+    auto UnrolledQueue<T, ChunkCapacity>::ChunkMemoryManager::createEmpty(size_t blockCount) const -> mm::MemoryManager<BlockType>*
+    {
+        static_cast<void>(blockCount);
+        return new ChunkMemoryManager();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,511 @@
+#pragma once
+
+#include <libds/amt/implicit_sequence.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define DS_SORTING_NETWORK_SSE2
+#endif
+
+namespace ds::adt
+{
+    /**
+     * @brief Compare-exchange of a sorting network, the lesser element ends up at low_.
+     */
+    struct NetworkComparator
+    {
+        std::uint16_t low_;
+        std::uint16_t high_;
+    };
+
+    /**
+     * @brief Writes the comparators of Batcher's merge-exchange network for @p size elements into @p out,
+     *        if it is not null, and returns their count.
+     */
+    constexpr size_t mergeExchangeNetwork(size_t size, NetworkComparator* out);
+
+    /**
+     * @brief Comparators of a sorting network for @p N elements.
+     *
+     * Networks with the least known number of comparators are listed for 2 to 16 elements,
+     * one layer of independent comparators per line. Longer networks are generated by
+     * Batcher's merge exchange at compile time.
+     */
+    template <size_t N>
+    struct SortingNetworkLayout
+    {
+        static constexpr std::array<NetworkComparator, mergeExchangeNetwork(N, nullptr)> comparators = []()
+            {
+                std::array<NetworkComparator, mergeExchangeNetwork(N, nullptr)> result{};
+                mergeExchangeNetwork(N, result.data());
+                return result;
+            }();
+    };
+
+    template <>
+    struct SortingNetworkLayout<2>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 1 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<3>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 2 },
+            { 0, 1 },
+            { 1, 2 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<4>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 2 }, { 1, 3 },
+            { 0, 1 }, { 2, 3 },
+            { 1, 2 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<5>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 3 }, { 1, 4 },
+            { 0, 2 }, { 1, 3 },
+            { 0, 1 }, { 2, 4 },
+            { 1, 2 }, { 3, 4 },
+            { 2, 3 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<6>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 5 }, { 1, 3 }, { 2, 4 },
+            { 1, 2 }, { 3, 4 },
+            { 0, 3 }, { 2, 5 },
+            { 0, 1 }, { 2, 3 }, { 4, 5 },
+            { 1, 2 }, { 3, 4 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<7>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 6 }, { 2, 3 }, { 4, 5 },
+            { 0, 2 }, { 1, 4 }, { 3, 6 },
+            { 0, 1 }, { 2, 5 }, { 3, 4 },
+            { 1, 2 }, { 4, 6 },
+            { 2, 3 }, { 4, 5 },
+            { 1, 2 }, { 3, 4 }, { 5, 6 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<8>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },
+            { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 },
+            { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },
+            { 2, 4 }, { 3, 5 },
+            { 1, 4 }, { 3, 6 },
+            { 1, 2 }, { 3, 4 }, { 5, 6 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<9>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 3 }, { 1, 7 }, { 2, 5 }, { 4, 8 },
+            { 0, 7 }, { 2, 4 }, { 3, 8 }, { 5, 6 },
+            { 0, 2 }, { 1, 3 }, { 4, 5 }, { 7, 8 },
+            { 1, 4 }, { 3, 6 }, { 5, 7 },
+            { 0, 1 }, { 2, 4 }, { 3, 5 }, { 6, 8 },
+            { 2, 3 }, { 4, 5 }, { 6, 7 },
+            { 1, 2 }, { 3, 4 }, { 5, 6 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<10>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 8 }, { 1, 9 }, { 2, 7 }, { 3, 5 }, { 4, 6 },
+            { 0, 2 }, { 1, 4 }, { 5, 8 }, { 7, 9 },
+            { 0, 3 }, { 2, 4 }, { 5, 7 }, { 6, 9 },
+            { 0, 1 }, { 3, 6 }, { 8, 9 },
+            { 1, 5 }, { 2, 3 }, { 4, 8 }, { 6, 7 },
+            { 1, 2 }, { 3, 5 }, { 4, 6 }, { 7, 8 },
+            { 2, 3 }, { 4, 5 }, { 6, 7 },
+            { 3, 4 }, { 5, 6 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<11>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 9 }, { 1, 6 }, { 2, 4 }, { 3, 7 }, { 5, 8 },
+            { 0, 1 }, { 3, 5 }, { 4, 10 }, { 6, 9 }, { 7, 8 },
+            { 1, 3 }, { 2, 5 }, { 4, 7 }, { 8, 10 },
+            { 0, 4 }, { 1, 2 }, { 3, 7 }, { 5, 9 }, { 6, 8 },
+            { 0, 1 }, { 2, 6 }, { 4, 5 }, { 7, 8 }, { 9, 10 },
+            { 2, 4 }, { 3, 6 }, { 5, 7 }, { 8, 9 },
+            { 1, 2 }, { 3, 4 }, { 5, 6 }, { 7, 8 },
+            { 2, 3 }, { 4, 5 }, { 6, 7 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<12>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 8 }, { 1, 7 }, { 2, 6 }, { 3, 11 }, { 4, 10 }, { 5, 9 },
+            { 0, 1 }, { 2, 5 }, { 3, 4 }, { 6, 9 }, { 7, 8 }, { 10, 11 },
+            { 0, 2 }, { 1, 6 }, { 5, 10 }, { 9, 11 },
+            { 0, 3 }, { 1, 2 }, { 4, 6 }, { 5, 7 }, { 8, 11 }, { 9, 10 },
+            { 1, 4 }, { 3, 5 }, { 6, 8 }, { 7, 10 },
+            { 1, 3 }, { 2, 5 }, { 6, 9 }, { 8, 10 },
+            { 2, 3 }, { 4, 5 }, { 6, 7 }, { 8, 9 },
+            { 4, 6 }, { 5, 7 },
+            { 3, 4 }, { 5, 6 }, { 7, 8 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<13>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 12 }, { 1, 10 }, { 2, 9 }, { 3, 7 }, { 5, 11 }, { 6, 8 },
+            { 1, 6 }, { 2, 3 }, { 4, 11 }, { 7, 9 }, { 8, 10 },
+            { 0, 4 }, { 1, 2 }, { 3, 6 }, { 7, 8 }, { 9, 10 }, { 11, 12 },
+            { 4, 6 }, { 5, 9 }, { 8, 11 }, { 10, 12 },
+            { 0, 5 }, { 3, 8 }, { 4, 7 }, { 6, 11 }, { 9, 10 },
+            { 0, 1 }, { 2, 5 }, { 6, 9 }, { 7, 8 }, { 10, 11 },
+            { 1, 3 }, { 2, 4 }, { 5, 6 }, { 9, 10 },
+            { 1, 2 }, { 3, 4 }, { 5, 7 }, { 6, 8 },
+            { 2, 3 }, { 4, 5 }, { 6, 7 }, { 8, 9 },
+            { 3, 4 }, { 5, 6 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<14>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 13 }, { 1, 12 }, { 4, 8 }, { 5, 6 }, { 7, 11 }, { 9, 10 },
+            { 0, 5 }, { 1, 7 }, { 2, 9 }, { 3, 4 }, { 6, 13 }, { 11, 12 },
+            { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 8 }, { 7, 9 }, { 10, 11 }, { 12, 13 },
+            { 0, 2 }, { 1, 3 }, { 4, 10 }, { 5, 11 }, { 6, 7 }, { 8, 9 },
+            { 1, 2 }, { 3, 12 }, { 4, 6 }, { 5, 7 }, { 8, 10 }, { 9, 11 },
+            { 1, 4 }, { 2, 6 }, { 5, 8 }, { 7, 10 }, { 9, 13 },
+            { 2, 4 }, { 3, 6 }, { 9, 12 }, { 11, 13 },
+            { 3, 5 }, { 6, 8 }, { 7, 9 }, { 10, 12 },
+            { 3, 4 }, { 5, 6 }, { 7, 8 }, { 9, 10 }, { 11, 12 },
+            { 6, 7 }, { 8, 9 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<15>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 13 }, { 1, 12 }, { 3, 14 }, { 4, 8 }, { 5, 6 }, { 7, 11 }, { 9, 10 },
+            { 0, 5 }, { 1, 7 }, { 2, 9 }, { 3, 4 }, { 6, 13 }, { 8, 14 }, { 11, 12 },
+            { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 8 }, { 7, 9 }, { 10, 11 }, { 12, 13 },
+            { 0, 2 }, { 1, 3 }, { 4, 10 }, { 5, 11 }, { 6, 7 }, { 8, 9 }, { 12, 14 },
+            { 1, 2 }, { 3, 12 }, { 4, 6 }, { 5, 7 }, { 8, 10 }, { 9, 11 }, { 13, 14 },
+            { 1, 4 }, { 2, 6 }, { 5, 8 }, { 7, 10 }, { 9, 13 }, { 11, 14 },
+            { 2, 4 }, { 3, 6 }, { 9, 12 }, { 11, 13 },
+            { 3, 5 }, { 6, 8 }, { 7, 9 }, { 10, 12 },
+            { 3, 4 }, { 5, 6 }, { 7, 8 }, { 9, 10 }, { 11, 12 },
+            { 6, 7 }, { 8, 9 }
+        };
+    };
+
+    template <>
+    struct SortingNetworkLayout<16>
+    {
+        static constexpr NetworkComparator comparators[] = {
+            { 0, 13 }, { 1, 12 }, { 2, 15 }, { 3, 14 }, { 4, 8 }, { 5, 6 }, { 7, 11 }, { 9, 10 },
+            { 0, 5 }, { 1, 7 }, { 2, 9 }, { 3, 4 }, { 6, 13 }, { 8, 14 }, { 10, 15 }, { 11, 12 },
+            { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 8 }, { 7, 9 }, { 10, 11 }, { 12, 13 }, { 14, 15 },
+            { 0, 2 }, { 1, 3 }, { 4, 10 }, { 5, 11 }, { 6, 7 }, { 8, 9 }, { 12, 14 }, { 13, 15 },
+            { 1, 2 }, { 3, 12 }, { 4, 6 }, { 5, 7 }, { 8, 10 }, { 9, 11 }, { 13, 14 },
+            { 1, 4 }, { 2, 6 }, { 5, 8 }, { 7, 10 }, { 9, 13 }, { 11, 14 },
+            { 2, 4 }, { 3, 6 }, { 9, 12 }, { 11, 13 },
+            { 3, 5 }, { 6, 8 }, { 7, 9 }, { 10, 12 },
+            { 3, 4 }, { 5, 6 }, { 7, 8 }, { 9, 10 }, { 11, 12 },
+            { 6, 7 }, { 8, 9 }
+        };
+    };
+
+    //----------
+
+    /**
+     * @brief Sorts exactly @p N contiguous blocks by a fully unrolled sorting network.
+     *
+     * The sequence of comparisons does not depend on the keys. Arithmetic and pointer keys
+     * are compare-exchanged without branches, float and double keys ordered by std::less or
+     * std::greater by SSE2 min and max instructions. Other keys are swapped only when out of order.
+     * The sort is not stable.
+     */
+    template <size_t N>
+    class SortingNetwork
+    {
+    public:
+        static constexpr size_t comparatorCount();
+
+        template<typename BlockType, typename Compare>
+        static void sort(BlockType* blocks, Compare& compare);
+
+    private:
+        template<typename BlockType, typename Compare, size_t... Index>
+        static void apply(BlockType* blocks, Compare& compare, std::index_sequence<Index...>);
+
+        template<typename BlockType, typename Compare>
+        static void compareExchange(BlockType& low, BlockType& high, Compare& compare);
+
+        template<typename T, typename Compare>
+        static constexpr bool isAscending();
+
+        template<typename T, typename Compare>
+        static constexpr bool isDescending();
+
+#ifdef DS_SORTING_NETWORK_SSE2
+        template<bool Descending>
+        static void minMax(double& low, double& high);
+
+        template<bool Descending>
+        static void minMax(float& low, float& high);
+#endif
+    };
+
+    /**
+     * @brief Sorts short ranges by the sorting network of their size.
+     */
+    class SortingNetworks
+    {
+    public:
+        static const size_t MAX_SIZE = 16;
+
+        /**
+         * @brief Sorts @p size contiguous blocks starting at @p blocks, @p size must not exceed MAX_SIZE.
+         */
+        template<typename BlockType, typename Compare>
+        static void sortRange(BlockType* blocks, size_t size, Compare& compare);
+
+    private:
+        template<typename BlockType, typename Compare, size_t... Size>
+        static void dispatch(BlockType* blocks, size_t size, Compare& compare, std::index_sequence<Size...>);
+    };
+
+    /**
+     * @brief Sorts a sequence of at most SortingNetworks::MAX_SIZE elements by a sorting network.
+     */
+    template <typename T, typename Compare = std::less<T>>
+    void networkSort(amt::ImplicitSequence<T>& is, Compare compare = Compare());
+
+    //----------
+
+    constexpr size_t mergeExchangeNetwork(size_t size, NetworkComparator* out)
+    {
+        // Knuth, TAOCP vol. 3, algorithm 5.2.2M.
+        size_t count = 0;
+        if (size < 2)
+        {
+            return count;
+        }
+
+        size_t top = 1;
+        while (top * 2 < size)
+        {
+            top *= 2;
+        }
+
+        for (size_t p = top; p > 0; p /= 2)
+        {
+            size_t q = top;
+            size_t r = 0;
+            size_t d = p;
+            for (;;)
+            {
+                for (size_t i = 0; i + d < size; ++i)
+                {
+                    if ((i & p) == r)
+                    {
+                        if (out != nullptr)
+                        {
+                            out[count] = { static_cast<std::uint16_t>(i), static_cast<std::uint16_t>(i + d) };
+                        }
+                        ++count;
+                    }
+                }
+                if (q == p)
+                {
+                    break;
+                }
+                d = q - p;
+                q /= 2;
+                r = p;
+            }
+        }
+        return count;
+    }
+
+    template<size_t N>
+    constexpr size_t SortingNetwork<N>::comparatorCount()
+    {
+        return std::size(SortingNetworkLayout<N>::comparators);
+    }
+
+    template<size_t N>
+    template<typename BlockType, typename Compare>
+    void SortingNetwork<N>::sort(BlockType* blocks, Compare& compare)
+    {
+        apply(blocks, compare, std::make_index_sequence<comparatorCount()>());
+    }
+
+    template<size_t N>
+    template<typename BlockType, typename Compare, size_t... Index>
+    void SortingNetwork<N>::apply([[maybe_unused]] BlockType* blocks, [[maybe_unused]] Compare& compare, std::index_sequence<Index...>)
+    {
+        (compareExchange(
+            blocks[SortingNetworkLayout<N>::comparators[Index].low_],
+            blocks[SortingNetworkLayout<N>::comparators[Index].high_],
+            compare), ...);
+    }
+
+    template<size_t N>
+    template<typename BlockType, typename Compare>
+    void SortingNetwork<N>::compareExchange(BlockType& low, BlockType& high, Compare& compare)
+    {
+        using T = decltype(low.data_);
+#ifdef DS_SORTING_NETWORK_SSE2
+        if constexpr (std::is_floating_point_v<T> && sizeof(T) <= sizeof(double) && (isAscending<T, Compare>() || isDescending<T, Compare>()))
+        {
+            minMax<isDescending<T, Compare>()>(low.data_, high.data_);
+        }
+        else
+#endif
+        if constexpr (std::is_arithmetic_v<T> || std::is_pointer_v<T>)
+        {
+            // Both keys are selected by the same comparison, so the pair is always permuted, even for NaN.
+            const bool exchange = compare(high.data_, low.data_);
+            const T lesser = exchange ? high.data_ : low.data_;
+            const T greater = exchange ? low.data_ : high.data_;
+            low.data_ = lesser;
+            high.data_ = greater;
+        }
+        else if (compare(high.data_, low.data_))
+        {
+            using std::swap;
+            swap(low.data_, high.data_);
+        }
+    }
+
+    template<size_t N>
+    template<typename T, typename Compare>
+    constexpr bool SortingNetwork<N>::isAscending()
+    {
+        return std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::less<>>;
+    }
+
+    template<size_t N>
+    template<typename T, typename Compare>
+    constexpr bool SortingNetwork<N>::isDescending()
+    {
+        return std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::greater<>>;
+    }
+
+#ifdef DS_SORTING_NETWORK_SSE2
+    // Scalar min and max return their second operand when the keys are unordered, so like the
+    // branchless exchange they select both keys by the same comparison and never duplicate a NaN.
+
+    template<size_t N>
+    template<bool Descending>
+    void SortingNetwork<N>::minMax(double& low, double& high)
+    {
+        const __m128d lowKey = _mm_set_sd(low);
+        const __m128d highKey = _mm_set_sd(high);
+        if constexpr (Descending)
+        {
+            low = _mm_cvtsd_f64(_mm_max_sd(highKey, lowKey));
+            high = _mm_cvtsd_f64(_mm_min_sd(lowKey, highKey));
+        }
+        else
+        {
+            low = _mm_cvtsd_f64(_mm_min_sd(highKey, lowKey));
+            high = _mm_cvtsd_f64(_mm_max_sd(lowKey, highKey));
+        }
+    }
+
+    template<size_t N>
+    template<bool Descending>
+    void SortingNetwork<N>::minMax(float& low, float& high)
+    {
+        const __m128 lowKey = _mm_set_ss(low);
+        const __m128 highKey = _mm_set_ss(high);
+        if constexpr (Descending)
+        {
+            low = _mm_cvtss_f32(_mm_max_ss(highKey, lowKey));
+            high = _mm_cvtss_f32(_mm_min_ss(lowKey, highKey));
+        }
+        else
+        {
+            low = _mm_cvtss_f32(_mm_min_ss(highKey, lowKey));
+            high = _mm_cvtss_f32(_mm_max_ss(lowKey, highKey));
+        }
+    }
+#endif
+
+    template<typename BlockType, typename Compare>
+    void SortingNetworks::sortRange(BlockType* blocks, size_t size, Compare& compare)
+    {
+        if (size > MAX_SIZE)
+        {
+            throw std::invalid_argument("Range is too long for a sorting network!");
+        }
+
+        dispatch(blocks, size, compare, std::make_index_sequence<MAX_SIZE + 1>());
+    }
+
+    template<typename BlockType, typename Compare, size_t... Size>
+    void SortingNetworks::dispatch(BlockType* blocks, size_t size, Compare& compare, std::index_sequence<Size...>)
+    {
+        using Network = void (*)(BlockType*, Compare&);
+        static constexpr Network networks[] = { &SortingNetwork<Size>::template sort<BlockType, Compare>... };
+        networks[size](blocks, compare);
+    }
+
+    template <typename T, typename Compare>
+    void networkSort(amt::ImplicitSequence<T>& is, Compare compare)
+    {
+        if (is.size() > SortingNetworks::MAX_SIZE)
+        {
+            throw std::invalid_argument("Sequence is too long for a sorting network!");
+        }
+
+        if (!is.isEmpty())
+        {
+            is.makeContiguous();
+            SortingNetworks::sortRange(is.accessFirst(), is.size(), compare);
+        }
+    }
+}
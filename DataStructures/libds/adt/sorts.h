@@ -3,10 +3,21 @@
 #include <libds/amt/implicit_sequence.h>
 #include <libds/adt/queue.h>
 #include <libds/adt/array.h>
+#include <libds/adt/sorting_network.h>
+#include <libds/exec/thread_pool.h>
 #include <functional>
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ds::adt
 {
@@ -20,6 +31,26 @@ namespace ds::adt
 
     //----------
 
+    /**
+     * @brief Scratch blocks for sorts that need a second array, kept between calls.
+     */
+    template <typename T>
+    class SortBuffer
+    {
+    public:
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+
+        /**
+         * @brief Returns at least @p size contiguous blocks.
+         */
+        BlockType* prepare(size_t size);
+
+    private:
+        amt::ImplicitSequence<T> blocks_;
+    };
+
+    //----------
+
     template <typename T>
     class SelectSort :
         public Sort<T>
@@ -63,6 +94,110 @@ namespace ds::adt
 
     //----------
 
+    /**
+     * @brief Pattern-defeating introsort.
+     *
+     * Quicksort with a median-of-3 pivot (ninther for large ranges), insertion sort for short
+     * ranges, and a heap sort fallback after too many unbalanced partitions, so the worst case
+     * is O(n log n). Sorted, reversed, and many-equal inputs are handled in (near) linear time.
+     * Only the smaller part is sorted recursively, so the recursion is at most O(log n) deep.
+     */
+    template <typename T>
+    class IntroSort :
+        public Sort<T>
+    {
+    public:
+        void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
+
+        /**
+         * @brief Sorts the contiguous blocks of @p is directly, so that @p compare can be inlined.
+         */
+        template<typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare compare);
+
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+
+        /**
+         * @brief Sorts @p size contiguous blocks starting at @p blocks.
+         */
+        template<typename Compare>
+        static void sortRange(BlockType* blocks, size_t size, Compare& compare);
+
+        /**
+         * @brief Moves the @p count least of @p size blocks to the front in sorted order, the rest in unspecified order.
+         * A max-heap of the @p count least blocks seen so far is kept in the front blocks.
+         */
+        template<typename Compare>
+        static void partialSortRange(BlockType* blocks, size_t size, size_t count, Compare& compare);
+
+        /**
+         * @brief Moves the block that would be at @p index in sorted order there, with no greater block
+         *        before it and no less block after it.
+         */
+        template<typename Compare>
+        static void selectRange(BlockType* blocks, size_t size, size_t index, Compare& compare);
+
+    private:
+        static const size_t INSERTION_SORT_THRESHOLD = 24;
+        static const size_t NINTHER_THRESHOLD = 128;
+        static const size_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+
+        template<typename Compare>
+        static void sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare);
+        template<typename Compare>
+        static void intro(BlockType* blocks, Compare& compare, size_t begin, size_t end, int badAllowed, bool leftmost);
+        template<typename Compare>
+        static void choosePivot(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+        template<typename Compare>
+        static size_t partitionRight(BlockType* blocks, Compare& compare, size_t begin, size_t end, bool& alreadyPartitioned);
+        template<typename Compare>
+        static size_t partitionLeft(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+        template<typename Compare>
+        static void insertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+        template<typename Compare>
+        static bool partialInsertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+        template<typename Compare>
+        static void heapSort(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+        template<typename Compare>
+        static void siftDown(BlockType* blocks, Compare& compare, size_t begin, size_t index, size_t size);
+        template<typename Compare>
+        static void sort2(BlockType* blocks, Compare& compare, size_t a, size_t b);
+        template<typename Compare>
+        static void sort3(BlockType* blocks, Compare& compare, size_t a, size_t b, size_t c);
+        static void swapAt(BlockType* blocks, size_t a, size_t b);
+    };
+
+    /**
+     * @brief Sorts only the @p count least elements of @p is into its front, in O(n log count).
+     */
+    template <typename T, typename Compare = std::less<T>>
+    void partialSort(amt::ImplicitSequence<T>& is, size_t count, Compare compare = Compare());
+
+    /**
+     * @brief Puts into position @p index the element that would be there if @p is was sorted,
+     *        with no greater element before it and no less element after it, in O(n) on average.
+     */
+    template <typename T, typename Compare = std::less<T>>
+    void nthElement(amt::ImplicitSequence<T>& is, size_t index, Compare compare = Compare());
+
+    /**
+     * @brief Returns the indices of the elements of @p is in stable order of their keys, @p is is not modified.
+     *
+     * Each key is computed only once. Only key and index pairs are sorted, so heavy elements are never moved.
+     */
+    template <typename T, typename KeyFn>
+    amt::ImplicitSequence<std::uint32_t> argsort(const amt::ImplicitSequence<T>& is, KeyFn getKey);
+
+    /**
+     * @brief Reorders @p is in place so that its i-th element is the element previously at @p order[i].
+     *
+     * Follows the cycles of the permutation, so every element is moved only once.
+     */
+    template <typename T>
+    void applyPermutation(amt::ImplicitSequence<T>& is, const amt::ImplicitSequence<std::uint32_t>& order);
+
+    //----------
+
     template <typename T>
     class HeapSort :
         public Sort<T>
@@ -86,6 +221,28 @@ namespace ds::adt
 
     //----------
 
+    /**
+     * @brief Key extractors mapping floating point values to unsigned integers of the same order.
+     *
+     * The sign bit is set for non-negative values and all bits are flipped for negative ones,
+     * so that RadixSort can sort by floating point keys.
+     */
+    struct RadixKeys
+    {
+        static std::uint32_t fromFloat(float value);
+        static std::uint64_t fromDouble(double value);
+    };
+
+    //----------
+
+    /**
+     * @brief LSD radix sort by an integral key, in ascending order of the key.
+     *
+     * Keys are extracted once and histograms of all digits are counted in one pass. A pass in
+     * which all keys share the digit is skipped. Elements and keys are scattered back and forth
+     * between the sequence and one scratch buffer. Signed keys are ordered by flipping the sign bit.
+     * Optionally, large sequences are counted and scattered in parallel chunks on the default thread pool.
+     */
     template <typename Key, typename T>
     class RadixSort :
         public Sort<T>
@@ -95,11 +252,102 @@ namespace ds::adt
     public:
         RadixSort();
         RadixSort(std::function<Key(const T&)> getKey);
+        RadixSort(std::function<Key(const T&)> getKey, bool parallel);
+
+        /**
+         * @brief Sorts by the keys.
+         */
+        void sort(amt::ImplicitSequence<T>& is);
 
+        /**
+         * @brief Sorts by the keys, @p compare is not used.
+         */
         void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
 
+    private:
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+        using RadixKey = std::make_unsigned_t<Key>;
+
+        static const unsigned KEY_BITS = sizeof(Key) * 8;
+        static const unsigned DIGIT_BITS = sizeof(Key) <= 2 ? 8 : 11;
+        static const unsigned PASS_COUNT = (KEY_BITS + DIGIT_BITS - 1) / DIGIT_BITS;
+        static const size_t BUCKET_COUNT = static_cast<size_t>(1) << DIGIT_BITS;
+        static const size_t PARALLEL_THRESHOLD = 1 << 20;
+
+        static RadixKey toRadixKey(Key key);
+        static size_t digitOf(RadixKey key, unsigned pass);
+
+        void countSequential(BlockType* blocks, size_t size, RadixKey* keys, size_t* histograms);
+        void countParallel(exec::ThreadPool& pool, BlockType* blocks, size_t size, RadixKey* keys, size_t* histograms);
+        void scatterSequential(BlockType* source, RadixKey* sourceKeys, size_t size, unsigned pass, const size_t* counts, BlockType* target, RadixKey* targetKeys);
+        void scatterParallel(exec::ThreadPool& pool, BlockType* source, RadixKey* sourceKeys, size_t size, unsigned pass, BlockType* target, RadixKey* targetKeys);
+
     private:
         std::function<Key(const T&)> getKey_;
+        bool parallel_;
+        SortBuffer<T> buffer_;
+        std::vector<RadixKey> keys_;
+        std::vector<RadixKey> keyBuffer_;
+    };
+
+    //----------
+
+    /**
+     * @brief Three-way radix quicksort (Bentley and Sedgewick) by string keys, in lexicographic order.
+     *
+     * A key consists of one or more components compared one after another, e.g. municipality
+     * and then street. Views of all components are extracted once and partitioning looks at
+     * one character at a time, so common prefixes are scanned once and no string is copied.
+     * The views must stay valid during the sort. The sort is not stable.
+     */
+    template <typename T>
+    class MultikeyQuickSort :
+        public Sort<T>
+    {
+    public:
+        using KeyExtractor = std::function<std::string_view(const T&)>;
+
+        MultikeyQuickSort(KeyExtractor getKey);
+        MultikeyQuickSort(std::initializer_list<KeyExtractor> getKeys);
+
+        /**
+         * @brief Sorts by the keys.
+         */
+        void sort(amt::ImplicitSequence<T>& is);
+
+        /**
+         * @brief Sorts by the keys, @p compare is not used.
+         */
+        void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
+
+    private:
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+
+        struct Entry
+        {
+            std::string_view key_;
+            size_t index_;
+        };
+
+        static const size_t INSERTION_SORT_THRESHOLD = 16;
+
+        /**
+         * @brief Character at @p depth shifted by one, 0 marks the end of the component.
+         */
+        static int charAt(std::string_view key, size_t depth);
+
+        std::string_view componentOf(size_t index, size_t component) const;
+        void loadComponent(size_t begin, size_t end, size_t component);
+        bool lessFrom(const Entry& first, const Entry& second, size_t component, size_t depth) const;
+
+        void multikey(size_t begin, size_t end, size_t component, size_t depth);
+        void insertionSort(size_t begin, size_t end, size_t component, size_t depth);
+
+    private:
+        std::vector<KeyExtractor> getKeys_;
+        std::vector<Entry> entries_;
+        std::vector<std::string_view> components_;
+        SortBuffer<T> buffer_;
     };
 
     //----------
@@ -111,18 +359,206 @@ namespace ds::adt
     public:
         void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
 
+        /**
+         * @brief Sorts the contiguous blocks of @p is directly, so that @p compare can be inlined.
+         */
+        template<typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare compare);
+
+    protected:
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+
+        /**
+         * @brief Stably sorts blocks [@p begin, @p end), using the same range of @p buffer as scratch.
+         */
+        template<typename Compare>
+        static void mergeSort(BlockType* blocks, BlockType* buffer, Compare& compare, size_t begin, size_t end);
+
+        /**
+         * @brief Stably merges the sorted runs [@p begin1, @p end1) and [@p begin2, @p end2) of @p source
+         *        into @p target starting at @p targetBegin.
+         */
+        template<typename Compare>
+        static void mergeInto(BlockType* source, Compare& compare, size_t begin1, size_t end1, size_t begin2, size_t end2, BlockType* target, size_t targetBegin);
+
+        static const size_t INSERTION_SORT_THRESHOLD = 32;
+
+    private:
+        template<typename Compare>
+        void sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare);
+
+        template<typename Compare>
+        static void insertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+
+    protected:
+        SortBuffer<T> buffer_;
+    };
+
+    //----------
+
+    /**
+     * @brief Stable merge sort whose halves are sorted and merged in parallel on the default thread pool.
+     *
+     * Runs are merged back and forth between the sequence and a buffer of the same size.
+     * A merge of two long runs is split by a binary search around the middle of the longer run,
+     * so that both halves of the output can be written independently.
+     */
+    template <typename T>
+    class ParallelMergeSort :
+        public MergeSort<T>
+    {
+    public:
+        void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
+
+        template<typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare compare);
+
+    private:
+        using BlockType = typename MergeSort<T>::BlockType;
+
+        static const size_t SEQUENTIAL_THRESHOLD = 8192;
+
+        template<typename Compare>
+        void sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare);
+
+        template<typename Compare>
+        static void sortRange(exec::ThreadPool& pool, BlockType* blocks, BlockType* buffer, Compare& compare, size_t begin, size_t end, bool intoBuffer);
+
+        template<typename Compare>
+        static void parallelMerge(exec::ThreadPool& pool, BlockType* source, Compare& compare, size_t begin1, size_t end1, size_t begin2, size_t end2, BlockType* target, size_t targetBegin);
+    };
+
+    //----------
+
+    /**
+     * @brief Parallel sample sort for large sequences, not stable.
+     *
+     * Splitters chosen from a random sample divide the keys into buckets. Chunks of the sequence
+     * are classified and scattered into a buffer in parallel, then the buckets are sorted
+     * by IntroSort in parallel and moved back. Short sequences are sorted by IntroSort directly.
+     */
+    template <typename T>
+    class SampleSort :
+        public Sort<T>
+    {
+    public:
+        void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
+
+        template<typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare compare);
+
+    private:
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+
+        static const size_t SEQUENTIAL_THRESHOLD = 65'536;
+        static const size_t OVERSAMPLING = 32;
+        static const size_t MAX_BUCKET_COUNT = 1024;
+
+        template<typename Compare>
+        void sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare);
+
+    private:
+        SortBuffer<T> buffer_;
+    };
+
+    //----------
+
+    /**
+     * @brief Adaptive natural merge sort in the style of Timsort, stable.
+     *
+     * Ascending and strictly descending runs already present in the input are detected, short
+     * runs are extended by binary insertion sort and the runs are merged following the stack
+     * invariants of Timsort. Merges switch to galloping when one run keeps winning, so sorted
+     * input takes linear time and nearly sorted input close to it.
+     */
+    template <typename T>
+    class TimSort :
+        public Sort<T>
+    {
+    public:
+        void sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare) override;
+
+        template<typename Compare>
+        void sort(amt::ImplicitSequence<T>& is, Compare compare);
+
     private:
-        void split(size_t n);
-        void merge(std::function<bool(const T&, const T&)> compare, size_t n);
+        using BlockType = typename amt::ImplicitSequence<T>::BlockType;
+
+        struct Run
+        {
+            size_t begin_;
+            size_t length_;
+        };
+
+        static const size_t MIN_MERGE = 32;
+        static const std::ptrdiff_t MIN_GALLOP = 7;
+
+        static size_t minRunLength(size_t size);
+
+        template<typename Compare>
+        void sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare);
+
+        /**
+         * @brief Returns the length of the run starting at @p begin, a descending run is reversed.
+         */
+        template<typename Compare>
+        static size_t countRunAndMakeAscending(BlockType* blocks, Compare& compare, size_t begin, size_t end);
+
+        /**
+         * @brief Sorts [@p begin, @p end) whose prefix [@p begin, @p sortedEnd) is already sorted.
+         */
+        template<typename Compare>
+        static void binaryInsertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t sortedEnd, size_t end);
+
+        /**
+         * @brief Returns the position of the first of @p length blocks not less than @p key, searching from @p hint.
+         */
+        template<typename Compare>
+        static std::ptrdiff_t gallopLeft(const T& key, const BlockType* blocks, std::ptrdiff_t length, std::ptrdiff_t hint, Compare& compare);
+
+        /**
+         * @brief Returns the position of the first of @p length blocks greater than @p key, searching from @p hint.
+         */
+        template<typename Compare>
+        static std::ptrdiff_t gallopRight(const T& key, const BlockType* blocks, std::ptrdiff_t length, std::ptrdiff_t hint, Compare& compare);
+
+        template<typename Compare>
+        void mergeCollapse(BlockType* blocks, Compare& compare);
+
+        template<typename Compare>
+        void mergeForceCollapse(BlockType* blocks, Compare& compare);
+
+        template<typename Compare>
+        void mergeAt(BlockType* blocks, Compare& compare, size_t index);
+
+        template<typename Compare>
+        void mergeLow(BlockType* blocks, Compare& compare, std::ptrdiff_t begin1, std::ptrdiff_t length1, std::ptrdiff_t begin2, std::ptrdiff_t length2);
+
+        template<typename Compare>
+        void mergeHigh(BlockType* blocks, Compare& compare, std::ptrdiff_t begin1, std::ptrdiff_t length1, std::ptrdiff_t begin2, std::ptrdiff_t length2);
 
     private:
-        ImplicitQueue<T>* queue1_{ nullptr };
-        ImplicitQueue<T>* queue2_{ nullptr };
-        ImplicitQueue<T>* mergeQueue_{ nullptr };
+        std::vector<Run> runs_;
+        std::ptrdiff_t minGallop_;
+        SortBuffer<T> buffer_;
     };
 
     //----------
 
+    template<typename T>
+    auto SortBuffer<T>::prepare(size_t size) -> BlockType*
+    {
+        if (blocks_.size() < size)
+        {
+            blocks_.changeCapacity(size);
+            while (blocks_.size() < size)
+            {
+                blocks_.insertLast();
+            }
+        }
+        return blocks_.accessFirst();
+    }
+
     template<typename T>
     void SelectSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
     {
@@ -208,68 +644,1831 @@ namespace ds::adt
     }
 
     template<typename T>
-    void HeapSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    void IntroSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        sortBlocks(is, compare);
     }
 
     template<typename T>
-    void ShellSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    template<typename Compare>
+    void IntroSort<T>::sort(amt::ImplicitSequence<T>& is, Compare compare)
     {
-        shell(is, compare, static_cast<size_t>(std::ceil(std::log10(is.size()))));
+        sortBlocks(is, compare);
     }
 
     template<typename T>
-    void ShellSort<T>::shell(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t k)
+    template<typename Compare>
+    void IntroSort<T>::sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        // Blocks of an implicit sequence are stored contiguously by its compact memory manager,
+        // once a gap buffer is closed.
+        is.makeContiguous();
+        sortRange(is.accessFirst(), is.size(), compare);
     }
 
-    template<typename Key, typename T>
-    RadixSort<Key, T>::RadixSort() :
-        getKey_([](auto const& x) { return x; })
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::sortRange(BlockType* blocks, size_t size, Compare& compare)
     {
+        if (size < 2)
+        {
+            return;
+        }
+
+        int badAllowed = 0;
+        for (size_t n = size; n > 1; n /= 2)
+        {
+            ++badAllowed;
+        }
+
+        intro(blocks, compare, 0, size, badAllowed, true);
     }
 
-    template<typename Key, typename T>
-    RadixSort<Key, T>::RadixSort(std::function<Key(const T&)> getKey) :
-        getKey_(getKey)
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::intro(BlockType* blocks, Compare& compare, size_t begin, size_t end, int badAllowed, bool leftmost)
     {
+        // Loops on the larger part instead of a second recursive call.
+        for (;;)
+        {
+            const size_t size = end - begin;
+            if (size <= SortingNetworks::MAX_SIZE)
+            {
+                SortingNetworks::sortRange(blocks + begin, size, compare);
+                return;
+            }
+            if (size < INSERTION_SORT_THRESHOLD)
+            {
+                insertionSort(blocks, compare, begin, end);
+                return;
+            }
+
+            choosePivot(blocks, compare, begin, end);
+
+            // The pivot equals the element just before this range, which is not greater than
+            // any element of the range. Elements equal to the pivot are put aside in one pass.
+            if (!leftmost && !compare(blocks[begin - 1].data_, blocks[begin].data_))
+            {
+                begin = partitionLeft(blocks, compare, begin, end) + 1;
+                continue;
+            }
+
+            bool alreadyPartitioned = false;
+            const size_t pivot = partitionRight(blocks, compare, begin, end, alreadyPartitioned);
+            const size_t leftSize = pivot - begin;
+            const size_t rightSize = end - (pivot + 1);
+
+            if (leftSize < size / 8 || rightSize < size / 8)
+            {
+                if (--badAllowed == 0)
+                {
+                    heapSort(blocks, compare, begin, end);
+                    return;
+                }
+
+                // Breaks patterns that could make the following pivots bad as well.
+                if (leftSize >= INSERTION_SORT_THRESHOLD)
+                {
+                    swapAt(blocks, begin, begin + leftSize / 4);
+                    swapAt(blocks, pivot - 1, pivot - leftSize / 4);
+                    if (leftSize > NINTHER_THRESHOLD)
+                    {
+                        swapAt(blocks, begin + 1, begin + leftSize / 4 + 1);
+                        swapAt(blocks, begin + 2, begin + leftSize / 4 + 2);
+                        swapAt(blocks, pivot - 2, pivot - leftSize / 4 - 1);
+                        swapAt(blocks, pivot - 3, pivot - leftSize / 4 - 2);
+                    }
+                }
+
+                if (rightSize >= INSERTION_SORT_THRESHOLD)
+                {
+                    swapAt(blocks, pivot + 1, pivot + 1 + rightSize / 4);
+                    swapAt(blocks, end - 1, end - rightSize / 4);
+                    if (rightSize > NINTHER_THRESHOLD)
+                    {
+                        swapAt(blocks, pivot + 2, pivot + 2 + rightSize / 4);
+                        swapAt(blocks, pivot + 3, pivot + 3 + rightSize / 4);
+                        swapAt(blocks, end - 2, end - rightSize / 4 - 1);
+                        swapAt(blocks, end - 3, end - rightSize / 4 - 2);
+                    }
+                }
+            }
+            else if (alreadyPartitioned
+                && partialInsertionSort(blocks, compare, begin, pivot)
+                && partialInsertionSort(blocks, compare, pivot + 1, end))
+            {
+                // A balanced partition without swaps suggests the range was (nearly) sorted.
+                return;
+            }
+
+            if (leftSize < rightSize)
+            {
+                intro(blocks, compare, begin, pivot, badAllowed, leftmost);
+                begin = pivot + 1;
+                leftmost = false;
+            }
+            else
+            {
+                intro(blocks, compare, pivot + 1, end, badAllowed, false);
+                end = pivot;
+            }
+        }
     }
 
-    template<typename Key, typename T>
-    void RadixSort<Key, T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::partialSortRange(BlockType* blocks, size_t size, size_t count, Compare& compare)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        count = (std::min)(count, size);
+        if (count == 0)
+        {
+            return;
+        }
+
+        for (size_t i = count / 2; i > 0; --i)
+        {
+            siftDown(blocks, compare, 0, i - 1, count);
+        }
+
+        // The root is the greatest of the kept blocks, a less block replaces it.
+        for (size_t i = count; i < size; ++i)
+        {
+            if (compare(blocks[i].data_, blocks[0].data_))
+            {
+                swapAt(blocks, 0, i);
+                siftDown(blocks, compare, 0, 0, count);
+            }
+        }
+
+        for (size_t last = count - 1; last > 0; --last)
+        {
+            swapAt(blocks, 0, last);
+            siftDown(blocks, compare, 0, 0, last);
+        }
     }
 
     template<typename T>
-    void MergeSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    template<typename Compare>
+    void IntroSort<T>::selectRange(BlockType* blocks, size_t size, size_t index, Compare& compare)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        size_t begin = 0;
+        size_t end = size;
+        bool leftmost = true;
+
+        int badAllowed = 0;
+        for (size_t n = size; n > 1; n /= 2)
+        {
+            ++badAllowed;
+        }
+
+        // Partitions like intro, but continues only into the part containing index.
+        for (;;)
+        {
+            const size_t rangeSize = end - begin;
+            if (rangeSize < INSERTION_SORT_THRESHOLD)
+            {
+                insertionSort(blocks, compare, begin, end);
+                return;
+            }
+
+            choosePivot(blocks, compare, begin, end);
+
+            if (!leftmost && !compare(blocks[begin - 1].data_, blocks[begin].data_))
+            {
+                // All blocks up to the returned one are equal to the pivot.
+                const size_t last = partitionLeft(blocks, compare, begin, end);
+                if (index <= last)
+                {
+                    return;
+                }
+                begin = last + 1;
+                continue;
+            }
+
+            bool alreadyPartitioned = false;
+            const size_t pivot = partitionRight(blocks, compare, begin, end, alreadyPartitioned);
+            if (pivot == index)
+            {
+                return;
+            }
+
+            const size_t leftSize = pivot - begin;
+            const size_t rightSize = end - (pivot + 1);
+            if ((leftSize < rangeSize / 8 || rightSize < rangeSize / 8) && --badAllowed == 0)
+            {
+                heapSort(blocks, compare, begin, end);
+                return;
+            }
+
+            if (index < pivot)
+            {
+                end = pivot;
+            }
+            else
+            {
+                begin = pivot + 1;
+                leftmost = false;
+            }
+        }
     }
 
     template<typename T>
-    void MergeSort<T>::split(size_t n)
+    template<typename Compare>
+    void IntroSort<T>::choosePivot(BlockType* blocks, Compare& compare, size_t begin, size_t end)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        // The median is moved to begin and serves as the pivot.
+        const size_t size = end - begin;
+        const size_t half = size / 2;
+        if (size > NINTHER_THRESHOLD)
+        {
+            sort3(blocks, compare, begin, begin + half, end - 1);
+            sort3(blocks, compare, begin + 1, begin + half - 1, end - 2);
+            sort3(blocks, compare, begin + 2, begin + half + 1, end - 3);
+            sort3(blocks, compare, begin + half - 1, begin + half, begin + half + 1);
+            swapAt(blocks, begin, begin + half);
+        }
+        else
+        {
+            sort3(blocks, compare, begin + half, begin, end - 1);
+        }
     }
 
     template<typename T>
-    void MergeSort<T>::merge(std::function<bool(const T&, const T&)> compare, size_t n)
+    template<typename Compare>
+    size_t IntroSort<T>::partitionRight(BlockType* blocks, Compare& compare, size_t begin, size_t end, bool& alreadyPartitioned)
     {
-        // TODO 12
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        // Elements equal to the pivot go right. The median-of-3 guarantees a sentinel on both sides.
+        T pivot = std::move(blocks[begin].data_);
+        size_t first = begin;
+        size_t last = end;
+
+        while (compare(blocks[++first].data_, pivot));
+
+        if (first - 1 == begin)
+        {
+            while (first < last && !compare(blocks[--last].data_, pivot));
+        }
+        else
+        {
+            while (!compare(blocks[--last].data_, pivot));
+        }
+
+        alreadyPartitioned = first >= last;
+
+        while (first < last)
+        {
+            swapAt(blocks, first, last);
+            while (compare(blocks[++first].data_, pivot));
+            while (!compare(blocks[--last].data_, pivot));
+        }
+
+        const size_t pivotIndex = first - 1;
+        blocks[begin].data_ = std::move(blocks[pivotIndex].data_);
+        blocks[pivotIndex].data_ = std::move(pivot);
+        return pivotIndex;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    size_t IntroSort<T>::partitionLeft(BlockType* blocks, Compare& compare, size_t begin, size_t end)
+    {
+        // Elements equal to the pivot go left, so the pivot ends up after all of them.
+        T pivot = std::move(blocks[begin].data_);
+        size_t first = begin;
+        size_t last = end;
+
+        while (compare(pivot, blocks[--last].data_));
+
+        if (last + 1 == end)
+        {
+            while (first < last && !compare(pivot, blocks[++first].data_));
+        }
+        else
+        {
+            while (!compare(pivot, blocks[++first].data_));
+        }
+
+        while (first < last)
+        {
+            swapAt(blocks, first, last);
+            while (compare(pivot, blocks[--last].data_));
+            while (!compare(pivot, blocks[++first].data_));
+        }
+
+        blocks[begin].data_ = std::move(blocks[last].data_);
+        blocks[last].data_ = std::move(pivot);
+        return last;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::insertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t end)
+    {
+        for (size_t i = begin + 1; i < end; ++i)
+        {
+            if (compare(blocks[i].data_, blocks[i - 1].data_))
+            {
+                T tmp = std::move(blocks[i].data_);
+                size_t j = i;
+                do
+                {
+                    blocks[j].data_ = std::move(blocks[j - 1].data_);
+                    --j;
+                }
+                while (j > begin && compare(tmp, blocks[j - 1].data_));
+                blocks[j].data_ = std::move(tmp);
+            }
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    bool IntroSort<T>::partialInsertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t end)
+    {
+        // Gives up once more than PARTIAL_INSERTION_SORT_LIMIT elements had to be moved.
+        size_t moved = 0;
+        for (size_t i = begin + 1; i < end; ++i)
+        {
+            if (compare(blocks[i].data_, blocks[i - 1].data_))
+            {
+                T tmp = std::move(blocks[i].data_);
+                size_t j = i;
+                do
+                {
+                    blocks[j].data_ = std::move(blocks[j - 1].data_);
+                    --j;
+                }
+                while (j > begin && compare(tmp, blocks[j - 1].data_));
+                blocks[j].data_ = std::move(tmp);
+                moved += i - j;
+            }
+
+            if (moved > PARTIAL_INSERTION_SORT_LIMIT)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::heapSort(BlockType* blocks, Compare& compare, size_t begin, size_t end)
+    {
+        const size_t size = end - begin;
+        for (size_t i = size / 2; i > 0; --i)
+        {
+            siftDown(blocks, compare, begin, i - 1, size);
+        }
+
+        for (size_t last = size - 1; last > 0; --last)
+        {
+            swapAt(blocks, begin, begin + last);
+            siftDown(blocks, compare, begin, 0, last);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::siftDown(BlockType* blocks, Compare& compare, size_t begin, size_t index, size_t size)
+    {
+        // Max-heap with respect to compare, rooted at begin.
+        for (;;)
+        {
+            size_t largest = index;
+            const size_t left = 2 * index + 1;
+            const size_t right = left + 1;
+
+            if (left < size && compare(blocks[begin + largest].data_, blocks[begin + left].data_))
+            {
+                largest = left;
+            }
+            if (right < size && compare(blocks[begin + largest].data_, blocks[begin + right].data_))
+            {
+                largest = right;
+            }
+            if (largest == index)
+            {
+                return;
+            }
+
+            swapAt(blocks, begin + index, begin + largest);
+            index = largest;
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::sort2(BlockType* blocks, Compare& compare, size_t a, size_t b)
+    {
+        if (compare(blocks[b].data_, blocks[a].data_))
+        {
+            swapAt(blocks, a, b);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void IntroSort<T>::sort3(BlockType* blocks, Compare& compare, size_t a, size_t b, size_t c)
+    {
+        sort2(blocks, compare, a, b);
+        sort2(blocks, compare, b, c);
+        sort2(blocks, compare, a, b);
+    }
+
+    template<typename T>
+    void IntroSort<T>::swapAt(BlockType* blocks, size_t a, size_t b)
+    {
+        using std::swap;
+        swap(blocks[a].data_, blocks[b].data_);
+    }
+
+    template <typename T, typename Compare>
+    void partialSort(amt::ImplicitSequence<T>& is, size_t count, Compare compare)
+    {
+        if (!is.isEmpty())
+        {
+            is.makeContiguous();
+            IntroSort<T>::partialSortRange(is.accessFirst(), is.size(), count, compare);
+        }
+    }
+
+    template <typename T, typename Compare>
+    void nthElement(amt::ImplicitSequence<T>& is, size_t index, Compare compare)
+    {
+        if (index >= is.size())
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        is.makeContiguous();
+        IntroSort<T>::selectRange(is.accessFirst(), is.size(), index, compare);
+    }
+
+    template <typename T, typename KeyFn>
+    amt::ImplicitSequence<std::uint32_t> argsort(const amt::ImplicitSequence<T>& is, KeyFn getKey)
+    {
+        using Key = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+        using Entry = std::pair<Key, std::uint32_t>;
+
+        const size_t size = is.size();
+        if (size > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::length_error("Sequence is too long to be indexed by 32 bits!");
+        }
+
+        amt::ImplicitSequence<std::uint32_t> order(size, false);
+        if (size == 0)
+        {
+            return order;
+        }
+
+        std::vector<amt::MemoryBlock<Entry>> entries(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            entries[i].data_ = Entry(getKey(is.access(i)->data_), static_cast<std::uint32_t>(i));
+        }
+
+        // Ties are broken by index, so the order is stable even though IntroSort is not.
+        auto compare = [](const Entry& lhs, const Entry& rhs)
+            {
+                return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+            };
+        IntroSort<Entry>::sortRange(entries.data(), size, compare);
+
+        for (const auto& entry : entries)
+        {
+            order.insertLast().data_ = entry.data_.second;
+        }
+        return order;
+    }
+
+    template <typename T>
+    void applyPermutation(amt::ImplicitSequence<T>& is, const amt::ImplicitSequence<std::uint32_t>& order)
+    {
+        const size_t size = is.size();
+        if (order.size() != size)
+        {
+            throw std::invalid_argument("Permutation size differs from sequence size!");
+        }
+        if (size == 0)
+        {
+            return;
+        }
+
+        is.makeContiguous();
+        auto* blocks = is.accessFirst();
+        std::vector<bool> placed(size, false);
+        for (size_t i = 0; i < size; ++i)
+        {
+            const size_t index = order.access(i)->data_;
+            if (index >= size || placed[index])
+            {
+                throw std::invalid_argument("Order is not a permutation!");
+            }
+            placed[index] = true;
+        }
+
+        placed.assign(size, false);
+        for (size_t start = 0; start < size; ++start)
+        {
+            if (placed[start])
+            {
+                continue;
+            }
+
+            T held = std::move(blocks[start].data_);
+            size_t current = start;
+            size_t next = order.access(start)->data_;
+            while (next != start)
+            {
+                blocks[current].data_ = std::move(blocks[next].data_);
+                placed[current] = true;
+                current = next;
+                next = order.access(next)->data_;
+            }
+            blocks[current].data_ = std::move(held);
+            placed[current] = true;
+        }
+    }
+
+    template<typename T>
+    void HeapSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        // TODO 12
+        // po implementacii vymazte vyhodenie vynimky!
+        throw std::runtime_error("Not implemented yet");
+    }
+
+    template<typename T>
+    void ShellSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        shell(is, compare, static_cast<size_t>(std::ceil(std::log10(is.size()))));
+    }
+
+    template<typename T>
+    void ShellSort<T>::shell(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare, size_t k)
+    {
+        // TODO 12
+        // po implementacii vymazte vyhodenie vynimky!
+        throw std::runtime_error("Not implemented yet");
+    }
+
+    inline std::uint32_t RadixKeys::fromFloat(float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+    }
+
+    inline std::uint64_t RadixKeys::fromDouble(double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return (bits & 0x8000000000000000ull) != 0 ? ~bits : bits | 0x8000000000000000ull;
+    }
+
+    template<typename Key, typename T>
+    RadixSort<Key, T>::RadixSort() :
+        RadixSort([](auto const& x) { return x; })
+    {
+    }
+
+    template<typename Key, typename T>
+    RadixSort<Key, T>::RadixSort(std::function<Key(const T&)> getKey) :
+        RadixSort(getKey, false)
+    {
+    }
+
+    template<typename Key, typename T>
+    RadixSort<Key, T>::RadixSort(std::function<Key(const T&)> getKey, bool parallel) :
+        getKey_(getKey),
+        parallel_(parallel)
+    {
+    }
+
+    template<typename Key, typename T>
+    void RadixSort<Key, T>::sort(amt::ImplicitSequence<T>& is, [[maybe_unused]] std::function<bool(const T&, const T&)> compare)
+    {
+        this->sort(is);
+    }
+
+    template<typename Key, typename T>
+    void RadixSort<Key, T>::sort(amt::ImplicitSequence<T>& is)
+    {
+        const size_t size = is.size();
+        if (size < 2)
+        {
+            return;
+        }
+
+        exec::ThreadPool* pool = parallel_ && size >= PARALLEL_THRESHOLD ? &exec::ThreadPool::getDefault() : nullptr;
+        is.makeContiguous();
+        BlockType* blocks = is.accessFirst();
+        BlockType* source = blocks;
+        BlockType* target = buffer_.prepare(size);
+
+        keys_.resize(size);
+        keyBuffer_.resize(size);
+        RadixKey* sourceKeys = keys_.data();
+        RadixKey* targetKeys = keyBuffer_.data();
+
+        std::vector<size_t> histograms(PASS_COUNT * BUCKET_COUNT, 0);
+        if (pool != nullptr)
+        {
+            this->countParallel(*pool, source, size, sourceKeys, histograms.data());
+        }
+        else
+        {
+            this->countSequential(source, size, sourceKeys, histograms.data());
+        }
+
+        for (unsigned pass = 0; pass < PASS_COUNT; ++pass)
+        {
+            const size_t* counts = histograms.data() + pass * BUCKET_COUNT;
+            if (counts[digitOf(sourceKeys[0], pass)] == size)
+            {
+                continue;
+            }
+
+            if (pool != nullptr)
+            {
+                this->scatterParallel(*pool, source, sourceKeys, size, pass, target, targetKeys);
+            }
+            else
+            {
+                this->scatterSequential(source, sourceKeys, size, pass, counts, target, targetKeys);
+            }
+
+            std::swap(source, target);
+            std::swap(sourceKeys, targetKeys);
+        }
+
+        if (source != blocks)
+        {
+            std::move(source, source + size, blocks);
+        }
+    }
+
+    template<typename Key, typename T>
+    auto RadixSort<Key, T>::toRadixKey(Key key) -> RadixKey
+    {
+        if constexpr (std::is_signed_v<Key>)
+        {
+            return static_cast<RadixKey>(key) ^ (static_cast<RadixKey>(1) << (KEY_BITS - 1));
+        }
+        else
+        {
+            return key;
+        }
+    }
+
+    template<typename Key, typename T>
+    size_t RadixSort<Key, T>::digitOf(RadixKey key, unsigned pass)
+    {
+        return static_cast<size_t>(key >> (pass * DIGIT_BITS)) & (BUCKET_COUNT - 1);
+    }
+
+    template<typename Key, typename T>
+    void RadixSort<Key, T>::countSequential(BlockType* blocks, size_t size, RadixKey* keys, size_t* histograms)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            const RadixKey key = toRadixKey(getKey_(blocks[i].data_));
+            keys[i] = key;
+            for (unsigned pass = 0; pass < PASS_COUNT; ++pass)
+            {
+                ++histograms[pass * BUCKET_COUNT + digitOf(key, pass)];
+            }
+        }
+    }
+
+    template<typename Key, typename T>
+    void RadixSort<Key, T>::countParallel(exec::ThreadPool& pool, BlockType* blocks, size_t size, RadixKey* keys, size_t* histograms)
+    {
+        const size_t chunkCount = 4 * pool.getThreadCount();
+        const size_t chunkSize = (size + chunkCount - 1) / chunkCount;
+        std::vector<size_t> chunkHistograms(chunkCount * PASS_COUNT * BUCKET_COUNT, 0);
+
+        pool.parallelFor(0, chunkCount, 1, [&](size_t chunk)
+            {
+                const size_t end = (std::min)(size, (chunk + 1) * chunkSize);
+                const size_t begin = (std::min)(end, chunk * chunkSize);
+                this->countSequential(blocks + begin, end - begin, keys + begin, chunkHistograms.data() + chunk * PASS_COUNT * BUCKET_COUNT);
+            });
+
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            const size_t* chunkHistogram = chunkHistograms.data() + chunk * PASS_COUNT * BUCKET_COUNT;
+            for (size_t i = 0; i < PASS_COUNT * BUCKET_COUNT; ++i)
+            {
+                histograms[i] += chunkHistogram[i];
+            }
+        }
+    }
+
+    template<typename Key, typename T>
+    void RadixSort<Key, T>::scatterSequential(BlockType* source, RadixKey* sourceKeys, size_t size, unsigned pass, const size_t* counts, BlockType* target, RadixKey* targetKeys)
+    {
+        std::vector<size_t> offsets(BUCKET_COUNT);
+        size_t offset = 0;
+        for (size_t digit = 0; digit < BUCKET_COUNT; ++digit)
+        {
+            offsets[digit] = offset;
+            offset += counts[digit];
+        }
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            const size_t position = offsets[digitOf(sourceKeys[i], pass)]++;
+            target[position].data_ = std::move(source[i].data_);
+            targetKeys[position] = sourceKeys[i];
+        }
+    }
+
+    template<typename Key, typename T>
+    void RadixSort<Key, T>::scatterParallel(exec::ThreadPool& pool, BlockType* source, RadixKey* sourceKeys, size_t size, unsigned pass, BlockType* target, RadixKey* targetKeys)
+    {
+        // The order of keys changes after each pass, so every chunk counts its digits again.
+        const size_t chunkCount = 4 * pool.getThreadCount();
+        const size_t chunkSize = (size + chunkCount - 1) / chunkCount;
+        std::vector<size_t> offsets(chunkCount * BUCKET_COUNT, 0);
+
+        pool.parallelFor(0, chunkCount, 1, [&](size_t chunk)
+            {
+                size_t* counts = offsets.data() + chunk * BUCKET_COUNT;
+                const size_t end = (std::min)(size, (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    ++counts[digitOf(sourceKeys[i], pass)];
+                }
+            });
+
+        size_t offset = 0;
+        for (size_t digit = 0; digit < BUCKET_COUNT; ++digit)
+        {
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                const size_t count = offsets[chunk * BUCKET_COUNT + digit];
+                offsets[chunk * BUCKET_COUNT + digit] = offset;
+                offset += count;
+            }
+        }
+
+        pool.parallelFor(0, chunkCount, 1, [&](size_t chunk)
+            {
+                size_t* positions = offsets.data() + chunk * BUCKET_COUNT;
+                const size_t end = (std::min)(size, (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    const size_t position = positions[digitOf(sourceKeys[i], pass)]++;
+                    target[position].data_ = std::move(source[i].data_);
+                    targetKeys[position] = sourceKeys[i];
+                }
+            });
+    }
+
+    template<typename T>
+    MultikeyQuickSort<T>::MultikeyQuickSort(KeyExtractor getKey) :
+        getKeys_({ getKey })
+    {
+    }
+
+    template<typename T>
+    MultikeyQuickSort<T>::MultikeyQuickSort(std::initializer_list<KeyExtractor> getKeys) :
+        getKeys_(getKeys)
+    {
+        if (getKeys_.empty())
+        {
+            throw std::invalid_argument("At least one key is required!");
+        }
+    }
+
+    template<typename T>
+    void MultikeyQuickSort<T>::sort(amt::ImplicitSequence<T>& is, [[maybe_unused]] std::function<bool(const T&, const T&)> compare)
+    {
+        this->sort(is);
+    }
+
+    template<typename T>
+    void MultikeyQuickSort<T>::sort(amt::ImplicitSequence<T>& is)
+    {
+        const size_t size = is.size();
+        if (size < 2)
+        {
+            return;
+        }
+
+        // The first component is kept next to the index, further components are loaded
+        // into the entries only for ranges equal in all previous components.
+        is.makeContiguous();
+        BlockType* blocks = is.accessFirst();
+        const size_t extraCount = getKeys_.size() - 1;
+        entries_.resize(size);
+        components_.resize(size * extraCount);
+        for (size_t i = 0; i < size; ++i)
+        {
+            entries_[i].key_ = getKeys_[0](blocks[i].data_);
+            entries_[i].index_ = i;
+            for (size_t k = 0; k < extraCount; ++k)
+            {
+                components_[i * extraCount + k] = getKeys_[k + 1](blocks[i].data_);
+            }
+        }
+
+        this->multikey(0, size, 0, 0);
+
+        BlockType* buffer = buffer_.prepare(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            buffer[i].data_ = std::move(blocks[entries_[i].index_].data_);
+        }
+        for (size_t i = 0; i < size; ++i)
+        {
+            blocks[i].data_ = std::move(buffer[i].data_);
+        }
+    }
+
+    template<typename T>
+    int MultikeyQuickSort<T>::charAt(std::string_view key, size_t depth)
+    {
+        return depth < key.size() ? static_cast<unsigned char>(key[depth]) + 1 : 0;
+    }
+
+    template<typename T>
+    std::string_view MultikeyQuickSort<T>::componentOf(size_t index, size_t component) const
+    {
+        const size_t extraCount = getKeys_.size() - 1;
+        return components_[index * extraCount + component - 1];
+    }
+
+    template<typename T>
+    void MultikeyQuickSort<T>::loadComponent(size_t begin, size_t end, size_t component)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            entries_[i].key_ = this->componentOf(entries_[i].index_, component);
+        }
+    }
+
+    template<typename T>
+    bool MultikeyQuickSort<T>::lessFrom(const Entry& first, const Entry& second, size_t component, size_t depth) const
+    {
+        // Both keys are equal in the first depth characters of the current component.
+        const int result = first.key_.substr(depth).compare(second.key_.substr(depth));
+        if (result != 0)
+        {
+            return result < 0;
+        }
+
+        for (size_t k = component + 1; k < getKeys_.size(); ++k)
+        {
+            const int next = this->componentOf(first.index_, k).compare(this->componentOf(second.index_, k));
+            if (next != 0)
+            {
+                return next < 0;
+            }
+        }
+        return false;
+    }
+
+    template<typename T>
+    void MultikeyQuickSort<T>::multikey(size_t begin, size_t end, size_t component, size_t depth)
+    {
+        while (end - begin > 1)
+        {
+            if (end - begin <= INSERTION_SORT_THRESHOLD)
+            {
+                this->insertionSort(begin, end, component, depth);
+                return;
+            }
+
+            const int a = charAt(entries_[begin].key_, depth);
+            const int b = charAt(entries_[begin + (end - begin) / 2].key_, depth);
+            const int c = charAt(entries_[end - 1].key_, depth);
+            const int pivot = (std::max)((std::min)(a, b), (std::min)((std::max)(a, b), c));
+
+            size_t less = begin;
+            size_t greater = end;
+            size_t i = begin;
+            while (i < greater)
+            {
+                const int character = charAt(entries_[i].key_, depth);
+                if (character < pivot)
+                {
+                    std::swap(entries_[less++], entries_[i++]);
+                }
+                else if (character > pivot)
+                {
+                    std::swap(entries_[i], entries_[--greater]);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            this->multikey(begin, less, component, depth);
+            this->multikey(greater, end, component, depth);
+
+            // Continue with the middle range, which shares one more character.
+            begin = less;
+            end = greater;
+            if (pivot != 0)
+            {
+                ++depth;
+            }
+            else if (++component < getKeys_.size())
+            {
+                this->loadComponent(begin, end, component);
+                depth = 0;
+            }
+            else
+            {
+                return;
+            }
+        }
+    }
+
+    template<typename T>
+    void MultikeyQuickSort<T>::insertionSort(size_t begin, size_t end, size_t component, size_t depth)
+    {
+        for (size_t i = begin + 1; i < end; ++i)
+        {
+            Entry entry = entries_[i];
+            size_t j = i;
+            while (j > begin && this->lessFrom(entry, entries_[j - 1], component, depth))
+            {
+                entries_[j] = entries_[j - 1];
+                --j;
+            }
+            entries_[j] = entry;
+        }
+    }
+
+    template<typename T>
+    void MergeSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void MergeSort<T>::sort(amt::ImplicitSequence<T>& is, Compare compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void MergeSort<T>::sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare)
+    {
+        const size_t size = is.size();
+        if (size < 2)
+        {
+            return;
+        }
+
+        // The buffer is indexed like the sequence, so that subranges never share scratch space.
+        BlockType* buffer = this->buffer_.prepare(size);
+        is.makeContiguous();
+        mergeSort(is.accessFirst(), buffer, compare, 0, size);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void MergeSort<T>::mergeSort(BlockType* blocks, BlockType* buffer, Compare& compare, size_t begin, size_t end)
+    {
+        if (end - begin <= INSERTION_SORT_THRESHOLD)
+        {
+            insertionSort(blocks, compare, begin, end);
+            return;
+        }
+
+        const size_t middle = begin + (end - begin) / 2;
+        mergeSort(blocks, buffer, compare, begin, middle);
+        mergeSort(blocks, buffer, compare, middle, end);
+
+        if (!compare(blocks[middle].data_, blocks[middle - 1].data_))
+        {
+            return;
+        }
+
+        // Only the left run is moved aside; the output never overtakes the unread part of the right run.
+        std::move(blocks + begin, blocks + middle, buffer + begin);
+
+        size_t i = begin;
+        size_t j = middle;
+        size_t k = begin;
+        while (i < middle && j < end)
+        {
+            if (compare(blocks[j].data_, buffer[i].data_))
+            {
+                blocks[k++].data_ = std::move(blocks[j++].data_);
+            }
+            else
+            {
+                blocks[k++].data_ = std::move(buffer[i++].data_);
+            }
+        }
+        std::move(buffer + i, buffer + middle, blocks + k);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void MergeSort<T>::mergeInto(BlockType* source, Compare& compare, size_t begin1, size_t end1, size_t begin2, size_t end2, BlockType* target, size_t targetBegin)
+    {
+        size_t i = begin1;
+        size_t j = begin2;
+        size_t k = targetBegin;
+
+        while (i < end1 && j < end2)
+        {
+            // Taking from the second run only if strictly less keeps the merge stable.
+            if (compare(source[j].data_, source[i].data_))
+            {
+                target[k++].data_ = std::move(source[j++].data_);
+            }
+            else
+            {
+                target[k++].data_ = std::move(source[i++].data_);
+            }
+        }
+
+        k = std::move(source + i, source + end1, target + k) - target;
+        std::move(source + j, source + end2, target + k);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void MergeSort<T>::insertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t end)
+    {
+        for (size_t i = begin + 1; i < end; ++i)
+        {
+            if (compare(blocks[i].data_, blocks[i - 1].data_))
+            {
+                T tmp = std::move(blocks[i].data_);
+                size_t j = i;
+                do
+                {
+                    blocks[j].data_ = std::move(blocks[j - 1].data_);
+                    --j;
+                }
+                while (j > begin && compare(tmp, blocks[j - 1].data_));
+                blocks[j].data_ = std::move(tmp);
+            }
+        }
+    }
+
+    template<typename T>
+    void ParallelMergeSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ParallelMergeSort<T>::sort(amt::ImplicitSequence<T>& is, Compare compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ParallelMergeSort<T>::sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare)
+    {
+        const size_t size = is.size();
+        if (size < 2)
+        {
+            return;
+        }
+
+        BlockType* buffer = this->buffer_.prepare(size);
+        is.makeContiguous();
+        sortRange(exec::ThreadPool::getDefault(), is.accessFirst(), buffer, compare, 0, size, false);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ParallelMergeSort<T>::sortRange(exec::ThreadPool& pool, BlockType* blocks, BlockType* buffer, Compare& compare, size_t begin, size_t end, bool intoBuffer)
+    {
+        if (end - begin <= SEQUENTIAL_THRESHOLD)
+        {
+            MergeSort<T>::mergeSort(blocks, buffer, compare, begin, end);
+            if (intoBuffer)
+            {
+                std::move(blocks + begin, blocks + end, buffer + begin);
+            }
+            return;
+        }
+
+        // Both halves end up in the other array, from which they are merged into the requested one.
+        const size_t middle = begin + (end - begin) / 2;
+        pool.invoke(
+            [&pool, blocks, buffer, &compare, begin, middle, intoBuffer]() { sortRange(pool, blocks, buffer, compare, begin, middle, !intoBuffer); },
+            [&pool, blocks, buffer, &compare, middle, end, intoBuffer]() { sortRange(pool, blocks, buffer, compare, middle, end, !intoBuffer); }
+        );
+
+        BlockType* source = intoBuffer ? blocks : buffer;
+        BlockType* target = intoBuffer ? buffer : blocks;
+        parallelMerge(pool, source, compare, begin, middle, middle, end, target, begin);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void ParallelMergeSort<T>::parallelMerge(exec::ThreadPool& pool, BlockType* source, Compare& compare, size_t begin1, size_t end1, size_t begin2, size_t end2, BlockType* target, size_t targetBegin)
+    {
+        const size_t size1 = end1 - begin1;
+        const size_t size2 = end2 - begin2;
+        if (size1 + size2 <= SEQUENTIAL_THRESHOLD)
+        {
+            MergeSort<T>::mergeInto(source, compare, begin1, end1, begin2, end2, target, targetBegin);
+            return;
+        }
+
+        // Equal keys of the first run must stay before those of the second one.
+        size_t split1;
+        size_t split2;
+        if (size1 >= size2)
+        {
+            split1 = begin1 + size1 / 2;
+            const T& key = source[split1].data_;
+            size_t low = begin2;
+            size_t high = end2;
+            while (low < high)
+            {
+                const size_t middle = low + (high - low) / 2;
+                if (compare(source[middle].data_, key)) { low = middle + 1; } else { high = middle; }
+            }
+            split2 = low;
+        }
+        else
+        {
+            split2 = begin2 + size2 / 2;
+            const T& key = source[split2].data_;
+            size_t low = begin1;
+            size_t high = end1;
+            while (low < high)
+            {
+                const size_t middle = low + (high - low) / 2;
+                if (compare(key, source[middle].data_)) { high = middle; } else { low = middle + 1; }
+            }
+            split1 = low;
+        }
+
+        const size_t targetMiddle = targetBegin + (split1 - begin1) + (split2 - begin2);
+        pool.invoke(
+            [&pool, source, &compare, begin1, split1, begin2, split2, target, targetBegin]()
+            {
+                parallelMerge(pool, source, compare, begin1, split1, begin2, split2, target, targetBegin);
+            },
+            [&pool, source, &compare, split1, end1, split2, end2, target, targetMiddle]()
+            {
+                parallelMerge(pool, source, compare, split1, end1, split2, end2, target, targetMiddle);
+            }
+        );
+    }
+
+    template<typename T>
+    void SampleSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void SampleSort<T>::sort(amt::ImplicitSequence<T>& is, Compare compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void SampleSort<T>::sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare)
+    {
+        const size_t size = is.size();
+        is.makeContiguous();
+        BlockType* blocks = is.accessFirst();
+        if (size < SEQUENTIAL_THRESHOLD)
+        {
+            IntroSort<T>::sortRange(blocks, size, compare);
+            return;
+        }
+
+        exec::ThreadPool& pool = exec::ThreadPool::getDefault();
+        const size_t bucketCount = (std::min)(static_cast<size_t>(MAX_BUCKET_COUNT), (std::max)(static_cast<size_t>(8), 4 * pool.getThreadCount()));
+        const size_t chunkCount = bucketCount;
+        const size_t chunkSize = (size + chunkCount - 1) / chunkCount;
+
+        // Splitters are every OVERSAMPLING-th key of a sorted random sample.
+        std::vector<T> sample;
+        sample.reserve(bucketCount * OVERSAMPLING);
+        std::minstd_rand rng(static_cast<std::minstd_rand::result_type>(size));
+        std::uniform_int_distribution<size_t> indexDist(0, size - 1);
+        for (size_t i = 0; i < bucketCount * OVERSAMPLING; ++i)
+        {
+            sample.push_back(blocks[indexDist(rng)].data_);
+        }
+        std::sort(sample.begin(), sample.end(), compare);
+
+        std::vector<T> splitters;
+        splitters.reserve(bucketCount - 1);
+        for (size_t i = 1; i < bucketCount; ++i)
+        {
+            splitters.push_back(sample[i * OVERSAMPLING]);
+        }
+
+        // Bucket of each key is remembered, so that the scatter doesn't have to search again.
+        std::vector<std::uint16_t> bucketOf(size);
+        std::vector<size_t> offsets(chunkCount * bucketCount, 0);
+        pool.parallelFor(0, chunkCount, 1, [&](size_t chunk)
+            {
+                size_t* counts = offsets.data() + chunk * bucketCount;
+                const size_t end = (std::min)(size, (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    const size_t bucket = std::upper_bound(splitters.begin(), splitters.end(), blocks[i].data_, compare) - splitters.begin();
+                    bucketOf[i] = static_cast<std::uint16_t>(bucket);
+                    ++counts[bucket];
+                }
+            });
+
+        // Counts are turned into positions in the buffer: buckets in order, chunks in order within a bucket.
+        std::vector<size_t> bucketBegins(bucketCount + 1, 0);
+        size_t position = 0;
+        for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+        {
+            bucketBegins[bucket] = position;
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                const size_t count = offsets[chunk * bucketCount + bucket];
+                offsets[chunk * bucketCount + bucket] = position;
+                position += count;
+            }
+        }
+        bucketBegins[bucketCount] = position;
+
+        BlockType* buffer = this->buffer_.prepare(size);
+        pool.parallelFor(0, chunkCount, 1, [&](size_t chunk)
+            {
+                size_t* positions = offsets.data() + chunk * bucketCount;
+                const size_t end = (std::min)(size, (chunk + 1) * chunkSize);
+                for (size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    buffer[positions[bucketOf[i]]++].data_ = std::move(blocks[i].data_);
+                }
+            });
+
+        pool.parallelFor(0, bucketCount, 1, [&](size_t bucket)
+            {
+                const size_t begin = bucketBegins[bucket];
+                const size_t end = bucketBegins[bucket + 1];
+                IntroSort<T>::sortRange(buffer + begin, end - begin, compare);
+                std::move(buffer + begin, buffer + end, blocks + begin);
+            });
+    }
+
+    template<typename T>
+    void TimSort<T>::sort(amt::ImplicitSequence<T>& is, std::function<bool(const T&, const T&)> compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::sort(amt::ImplicitSequence<T>& is, Compare compare)
+    {
+        sortBlocks(is, compare);
+    }
+
+    template<typename T>
+    size_t TimSort<T>::minRunLength(size_t size)
+    {
+        // Keeps size / minRun close to, but not above, a power of two.
+        size_t remainder = 0;
+        while (size >= MIN_MERGE)
+        {
+            remainder |= size & 1;
+            size >>= 1;
+        }
+        return size + remainder;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::sortBlocks(amt::ImplicitSequence<T>& is, Compare& compare)
+    {
+        const size_t size = is.size();
+        if (size < 2)
+        {
+            return;
+        }
+
+        is.makeContiguous();
+        BlockType* blocks = is.accessFirst();
+        if (size < MIN_MERGE)
+        {
+            binaryInsertionSort(blocks, compare, 0, countRunAndMakeAscending(blocks, compare, 0, size), size);
+            return;
+        }
+
+        runs_.clear();
+        minGallop_ = MIN_GALLOP;
+        const size_t minRun = minRunLength(size);
+
+        size_t begin = 0;
+        while (begin < size)
+        {
+            size_t length = countRunAndMakeAscending(blocks, compare, begin, size);
+            if (length < minRun)
+            {
+                const size_t forcedLength = (std::min)(minRun, size - begin);
+                binaryInsertionSort(blocks, compare, begin, begin + length, begin + forcedLength);
+                length = forcedLength;
+            }
+
+            runs_.push_back({ begin, length });
+            this->mergeCollapse(blocks, compare);
+            begin += length;
+        }
+
+        this->mergeForceCollapse(blocks, compare);
+    }
+
+    template<typename T>
+    template<typename Compare>
+    size_t TimSort<T>::countRunAndMakeAscending(BlockType* blocks, Compare& compare, size_t begin, size_t end)
+    {
+        size_t runEnd = begin + 1;
+        if (runEnd == end)
+        {
+            return 1;
+        }
+
+        // A descending run must be strict, otherwise reversing it would break stability.
+        if (compare(blocks[runEnd++].data_, blocks[begin].data_))
+        {
+            while (runEnd < end && compare(blocks[runEnd].data_, blocks[runEnd - 1].data_))
+            {
+                ++runEnd;
+            }
+            std::reverse(blocks + begin, blocks + runEnd);
+        }
+        else
+        {
+            while (runEnd < end && !compare(blocks[runEnd].data_, blocks[runEnd - 1].data_))
+            {
+                ++runEnd;
+            }
+        }
+
+        return runEnd - begin;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::binaryInsertionSort(BlockType* blocks, Compare& compare, size_t begin, size_t sortedEnd, size_t end)
+    {
+        for (size_t i = sortedEnd; i < end; ++i)
+        {
+            T pivot = std::move(blocks[i].data_);
+            size_t left = begin;
+            size_t right = i;
+            while (left < right)
+            {
+                const size_t middle = left + (right - left) / 2;
+                if (compare(pivot, blocks[middle].data_))
+                {
+                    right = middle;
+                }
+                else
+                {
+                    left = middle + 1;
+                }
+            }
+
+            std::move_backward(blocks + left, blocks + i, blocks + i + 1);
+            blocks[left].data_ = std::move(pivot);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    std::ptrdiff_t TimSort<T>::gallopLeft(const T& key, const BlockType* blocks, std::ptrdiff_t length, std::ptrdiff_t hint, Compare& compare)
+    {
+        std::ptrdiff_t lastOffset = 0;
+        std::ptrdiff_t offset = 1;
+
+        if (compare(blocks[hint].data_, key))
+        {
+            const std::ptrdiff_t maxOffset = length - hint;
+            while (offset < maxOffset && compare(blocks[hint + offset].data_, key))
+            {
+                lastOffset = offset;
+                offset = 2 * offset + 1;
+            }
+            offset = (std::min)(offset, maxOffset);
+            lastOffset += hint;
+            offset += hint;
+        }
+        else
+        {
+            const std::ptrdiff_t maxOffset = hint + 1;
+            while (offset < maxOffset && !compare(blocks[hint - offset].data_, key))
+            {
+                lastOffset = offset;
+                offset = 2 * offset + 1;
+            }
+            offset = (std::min)(offset, maxOffset);
+            const std::ptrdiff_t previous = lastOffset;
+            lastOffset = hint - offset;
+            offset = hint - previous;
+        }
+
+        // blocks[lastOffset] < key <= blocks[offset], finish by binary search.
+        ++lastOffset;
+        while (lastOffset < offset)
+        {
+            const std::ptrdiff_t middle = lastOffset + (offset - lastOffset) / 2;
+            if (compare(blocks[middle].data_, key))
+            {
+                lastOffset = middle + 1;
+            }
+            else
+            {
+                offset = middle;
+            }
+        }
+        return offset;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    std::ptrdiff_t TimSort<T>::gallopRight(const T& key, const BlockType* blocks, std::ptrdiff_t length, std::ptrdiff_t hint, Compare& compare)
+    {
+        std::ptrdiff_t lastOffset = 0;
+        std::ptrdiff_t offset = 1;
+
+        if (compare(key, blocks[hint].data_))
+        {
+            const std::ptrdiff_t maxOffset = hint + 1;
+            while (offset < maxOffset && compare(key, blocks[hint - offset].data_))
+            {
+                lastOffset = offset;
+                offset = 2 * offset + 1;
+            }
+            offset = (std::min)(offset, maxOffset);
+            const std::ptrdiff_t previous = lastOffset;
+            lastOffset = hint - offset;
+            offset = hint - previous;
+        }
+        else
+        {
+            const std::ptrdiff_t maxOffset = length - hint;
+            while (offset < maxOffset && !compare(key, blocks[hint + offset].data_))
+            {
+                lastOffset = offset;
+                offset = 2 * offset + 1;
+            }
+            offset = (std::min)(offset, maxOffset);
+            lastOffset += hint;
+            offset += hint;
+        }
+
+        // blocks[lastOffset] <= key < blocks[offset], finish by binary search.
+        ++lastOffset;
+        while (lastOffset < offset)
+        {
+            const std::ptrdiff_t middle = lastOffset + (offset - lastOffset) / 2;
+            if (compare(key, blocks[middle].data_))
+            {
+                offset = middle;
+            }
+            else
+            {
+                lastOffset = middle + 1;
+            }
+        }
+        return offset;
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::mergeCollapse(BlockType* blocks, Compare& compare)
+    {
+        // Checks the top three runs and the one below them, as corrected by de Gouw et al. (CAV 2015).
+        while (runs_.size() > 1)
+        {
+            size_t n = runs_.size() - 2;
+            if ((n > 0 && runs_[n - 1].length_ <= runs_[n].length_ + runs_[n + 1].length_) ||
+                (n > 1 && runs_[n - 2].length_ <= runs_[n - 1].length_ + runs_[n].length_))
+            {
+                if (runs_[n - 1].length_ < runs_[n + 1].length_)
+                {
+                    --n;
+                }
+            }
+            else if (runs_[n].length_ > runs_[n + 1].length_)
+            {
+                return;
+            }
+            this->mergeAt(blocks, compare, n);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::mergeForceCollapse(BlockType* blocks, Compare& compare)
+    {
+        while (runs_.size() > 1)
+        {
+            size_t n = runs_.size() - 2;
+            if (n > 0 && runs_[n - 1].length_ < runs_[n + 1].length_)
+            {
+                --n;
+            }
+            this->mergeAt(blocks, compare, n);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::mergeAt(BlockType* blocks, Compare& compare, size_t index)
+    {
+        std::ptrdiff_t begin1 = static_cast<std::ptrdiff_t>(runs_[index].begin_);
+        std::ptrdiff_t length1 = static_cast<std::ptrdiff_t>(runs_[index].length_);
+        const std::ptrdiff_t begin2 = static_cast<std::ptrdiff_t>(runs_[index + 1].begin_);
+        std::ptrdiff_t length2 = static_cast<std::ptrdiff_t>(runs_[index + 1].length_);
+
+        runs_[index].length_ += runs_[index + 1].length_;
+        runs_.erase(runs_.begin() + index + 1);
+
+        // Blocks of the first run not greater than the first of the second run are already in place.
+        const std::ptrdiff_t skipped = gallopRight(blocks[begin2].data_, blocks + begin1, length1, 0, compare);
+        begin1 += skipped;
+        length1 -= skipped;
+        if (length1 == 0)
+        {
+            return;
+        }
+
+        // So are the blocks of the second run not less than the last of the first run.
+        length2 = gallopLeft(blocks[begin1 + length1 - 1].data_, blocks + begin2, length2, length2 - 1, compare);
+        if (length2 == 0)
+        {
+            return;
+        }
+
+        if (length1 <= length2)
+        {
+            this->mergeLow(blocks, compare, begin1, length1, begin2, length2);
+        }
+        else
+        {
+            this->mergeHigh(blocks, compare, begin1, length1, begin2, length2);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::mergeLow(BlockType* blocks, Compare& compare, std::ptrdiff_t begin1, std::ptrdiff_t length1, std::ptrdiff_t begin2, std::ptrdiff_t length2)
+    {
+        // The first run is moved aside and merged from the front.
+        BlockType* buffer = buffer_.prepare(static_cast<size_t>(length1));
+        std::move(blocks + begin1, blocks + begin1 + length1, buffer);
+
+        std::ptrdiff_t cursor1 = 0;
+        std::ptrdiff_t cursor2 = begin2;
+        std::ptrdiff_t target = begin1;
+
+        blocks[target++].data_ = std::move(blocks[cursor2++].data_);
+        if (--length2 == 0)
+        {
+            std::move(buffer + cursor1, buffer + cursor1 + length1, blocks + target);
+            return;
+        }
+        if (length1 == 1)
+        {
+            std::move(blocks + cursor2, blocks + cursor2 + length2, blocks + target);
+            blocks[target + length2].data_ = std::move(buffer[cursor1].data_);
+            return;
+        }
+
+        std::ptrdiff_t minGallop = minGallop_;
+        bool done = false;
+        while (!done)
+        {
+            std::ptrdiff_t count1 = 0;
+            std::ptrdiff_t count2 = 0;
+
+            do
+            {
+                if (compare(blocks[cursor2].data_, buffer[cursor1].data_))
+                {
+                    blocks[target++].data_ = std::move(blocks[cursor2++].data_);
+                    ++count2;
+                    count1 = 0;
+                    done = --length2 == 0;
+                }
+                else
+                {
+                    blocks[target++].data_ = std::move(buffer[cursor1++].data_);
+                    ++count1;
+                    count2 = 0;
+                    done = --length1 == 1;
+                }
+            }
+            while (!done && (count1 | count2) < minGallop);
+
+            while (!done)
+            {
+                count1 = gallopRight(blocks[cursor2].data_, buffer + cursor1, length1, 0, compare);
+                if (count1 != 0)
+                {
+                    std::move(buffer + cursor1, buffer + cursor1 + count1, blocks + target);
+                    target += count1;
+                    cursor1 += count1;
+                    length1 -= count1;
+                    if (length1 <= 1)
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+                blocks[target++].data_ = std::move(blocks[cursor2++].data_);
+                if (--length2 == 0)
+                {
+                    done = true;
+                    break;
+                }
+
+                count2 = gallopLeft(buffer[cursor1].data_, blocks + cursor2, length2, 0, compare);
+                if (count2 != 0)
+                {
+                    std::move(blocks + cursor2, blocks + cursor2 + count2, blocks + target);
+                    target += count2;
+                    cursor2 += count2;
+                    length2 -= count2;
+                    if (length2 == 0)
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+                blocks[target++].data_ = std::move(buffer[cursor1++].data_);
+                if (--length1 == 1)
+                {
+                    done = true;
+                    break;
+                }
+
+                --minGallop;
+                if (count1 < MIN_GALLOP && count2 < MIN_GALLOP)
+                {
+                    break;
+                }
+            }
+
+            // Leaving the galloping mode makes it harder to enter again.
+            minGallop = (std::max)(minGallop, static_cast<std::ptrdiff_t>(0)) + 2;
+        }
+        minGallop_ = (std::max)(minGallop, static_cast<std::ptrdiff_t>(1));
+
+        if (length1 == 1)
+        {
+            std::move(blocks + cursor2, blocks + cursor2 + length2, blocks + target);
+            blocks[target + length2].data_ = std::move(buffer[cursor1].data_);
+        }
+        else if (length1 == 0)
+        {
+            throw std::invalid_argument("Comparator does not define a strict weak ordering!");
+        }
+        else
+        {
+            std::move(buffer + cursor1, buffer + cursor1 + length1, blocks + target);
+        }
+    }
+
+    template<typename T>
+    template<typename Compare>
+    void TimSort<T>::mergeHigh(BlockType* blocks, Compare& compare, std::ptrdiff_t begin1, std::ptrdiff_t length1, std::ptrdiff_t begin2, std::ptrdiff_t length2)
+    {
+        // The second run is moved aside and merged from the back.
+        BlockType* buffer = buffer_.prepare(static_cast<size_t>(length2));
+        std::move(blocks + begin2, blocks + begin2 + length2, buffer);
+
+        std::ptrdiff_t cursor1 = begin1 + length1 - 1;
+        std::ptrdiff_t cursor2 = length2 - 1;
+        std::ptrdiff_t target = begin2 + length2 - 1;
+
+        blocks[target--].data_ = std::move(blocks[cursor1--].data_);
+        if (--length1 == 0)
+        {
+            std::move(buffer, buffer + length2, blocks + target - (length2 - 1));
+            return;
+        }
+        if (length2 == 1)
+        {
+            target -= length1;
+            cursor1 -= length1;
+            std::move_backward(blocks + cursor1 + 1, blocks + cursor1 + 1 + length1, blocks + target + 1 + length1);
+            blocks[target].data_ = std::move(buffer[cursor2].data_);
+            return;
+        }
+
+        std::ptrdiff_t minGallop = minGallop_;
+        bool done = false;
+        while (!done)
+        {
+            std::ptrdiff_t count1 = 0;
+            std::ptrdiff_t count2 = 0;
+
+            do
+            {
+                if (compare(buffer[cursor2].data_, blocks[cursor1].data_))
+                {
+                    blocks[target--].data_ = std::move(blocks[cursor1--].data_);
+                    ++count1;
+                    count2 = 0;
+                    done = --length1 == 0;
+                }
+                else
+                {
+                    blocks[target--].data_ = std::move(buffer[cursor2--].data_);
+                    ++count2;
+                    count1 = 0;
+                    done = --length2 == 1;
+                }
+            }
+            while (!done && (count1 | count2) < minGallop);
+
+            while (!done)
+            {
+                count1 = length1 - gallopRight(buffer[cursor2].data_, blocks + begin1, length1, length1 - 1, compare);
+                if (count1 != 0)
+                {
+                    target -= count1;
+                    cursor1 -= count1;
+                    length1 -= count1;
+                    std::move_backward(blocks + cursor1 + 1, blocks + cursor1 + 1 + count1, blocks + target + 1 + count1);
+                    if (length1 == 0)
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+                blocks[target--].data_ = std::move(buffer[cursor2--].data_);
+                if (--length2 == 1)
+                {
+                    done = true;
+                    break;
+                }
+
+                count2 = length2 - gallopLeft(blocks[cursor1].data_, buffer, length2, length2 - 1, compare);
+                if (count2 != 0)
+                {
+                    target -= count2;
+                    cursor2 -= count2;
+                    length2 -= count2;
+                    std::move(buffer + cursor2 + 1, buffer + cursor2 + 1 + count2, blocks + target + 1);
+                    if (length2 <= 1)
+                    {
+                        done = true;
+                        break;
+                    }
+                }
+                blocks[target--].data_ = std::move(blocks[cursor1--].data_);
+                if (--length1 == 0)
+                {
+                    done = true;
+                    break;
+                }
+
+                --minGallop;
+                if (count1 < MIN_GALLOP && count2 < MIN_GALLOP)
+                {
+                    break;
+                }
+            }
+
+            minGallop = (std::max)(minGallop, static_cast<std::ptrdiff_t>(0)) + 2;
+        }
+        minGallop_ = (std::max)(minGallop, static_cast<std::ptrdiff_t>(1));
+
+        if (length2 == 1)
+        {
+            target -= length1;
+            cursor1 -= length1;
+            std::move_backward(blocks + cursor1 + 1, blocks + cursor1 + 1 + length1, blocks + target + 1 + length1);
+            blocks[target].data_ = std::move(buffer[cursor2].data_);
+        }
+        else if (length2 == 0)
+        {
+            throw std::invalid_argument("Comparator does not define a strict weak ordering!");
+        }
+        else
+        {
+            std::move(buffer, buffer + length2, blocks + target - (length2 - 1));
+        }
     }
-}
+}
\ No newline at end of file
@@ -485,17 +485,36 @@ namespace ds::adt {
     template<typename K, typename T>
     void SortedSequenceTable<K, T>::insert(const K& key, T data)
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        amt::ImplicitSequence<TableItem<K, T>>* seq = this->getSequence();
+        BlockType* lastBlock = nullptr;
+        if (this->tryFindBlockWithKey(key, 0, this->size(), lastBlock)) {
+            throw std::invalid_argument("Key already exists!");
+        }
+
+        // The search ends next to the place where the key belongs.
+        size_t index = 0;
+        if (lastBlock != nullptr) {
+            index = seq->calculateIndex(*lastBlock);
+            if (lastBlock->data_.key_ < key) {
+                ++index;
+            }
+        }
+
+        seq->insert(index).data_ = TableItem<K, T>{ key, data };
     }
 
     template<typename K, typename T>
     T SortedSequenceTable<K, T>::remove(const K& key)
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        BlockType* block = this->findBlockWithKey(key);
+        if (block == nullptr) {
+            throw std::out_of_range("No such key!");
+        }
+
+        T result = block->data_.data_;
+        amt::ImplicitSequence<TableItem<K, T>>* seq = this->getSequence();
+        seq->remove(seq->calculateIndex(*block));
+        return result;
     }
 
     template<typename K, typename T>
@@ -510,9 +529,7 @@ namespace ds::adt {
     template<typename K, typename T>
     bool SortedSequenceTable<K, T>::equals(const ADT& other)
     {
-        // TODO 10
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        return this->areEqual(*this, other);
     }
 
     template<typename K, typename T>
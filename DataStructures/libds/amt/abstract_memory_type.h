@@ -41,6 +41,7 @@ namespace ds::amt {
 		virtual size_t size() const = 0;
 		virtual bool isEmpty() const = 0;
 		virtual bool equals(const AbstractMemoryType& other) = 0;
+		virtual mm::MemoryStatistics getMemoryStatistics() const = 0;
 	};
 
 	using AMT = AbstractMemoryType;
@@ -57,6 +58,7 @@ namespace ds::amt {
 
 		size_t size() const override;
 		bool isEmpty() const override;
+		mm::MemoryStatistics getMemoryStatistics() const override;
 
     protected:
 		mm::MemoryManager<BlockType>* memoryManager_;
@@ -86,6 +88,10 @@ namespace ds::amt {
 
 		size_t getCapacity();
 		void changeCapacity(size_t newCapacity);
+		void setStoragePolicy(const mm::StoragePolicy& storagePolicy);
+		mm::StorageBackend getStorageBackend() const;
+		size_t getPageSize() const;
+		void setGapBuffer(bool gapBuffer);
 
 		static const int INIT_CAPACITY = 10;
 
@@ -228,6 +234,12 @@ namespace ds::amt {
 	    return this->size() == 0;
 	}
 
+    template <typename BlockType>
+    mm::MemoryStatistics AbstractMemoryStructure<BlockType>::getMemoryStatistics() const
+	{
+		return memoryManager_->getStatistics();
+	}
+
     template<typename DataType>
     ImplicitAbstractMemoryStructure<DataType>::ImplicitAbstractMemoryStructure():
 		ImplicitAbstractMemoryStructure<DataType>(INIT_CAPACITY, false)
@@ -303,6 +315,30 @@ namespace ds::amt {
 		this->getMemoryManager()->changeCapacity(newCapacity);
 	}
 
+	template<typename DataType>
+    void ImplicitAbstractMemoryStructure<DataType>::setStoragePolicy(const mm::StoragePolicy& storagePolicy)
+	{
+		this->getMemoryManager()->setStoragePolicy(storagePolicy);
+	}
+
+	template<typename DataType>
+    mm::StorageBackend ImplicitAbstractMemoryStructure<DataType>::getStorageBackend() const
+	{
+		return this->getMemoryManager()->getStorageBackend();
+	}
+
+	template<typename DataType>
+    size_t ImplicitAbstractMemoryStructure<DataType>::getPageSize() const
+	{
+		return this->getMemoryManager()->getPageSize();
+	}
+
+	template<typename DataType>
+    void ImplicitAbstractMemoryStructure<DataType>::setGapBuffer(bool gapBuffer)
+	{
+		this->getMemoryManager()->setGapBuffer(gapBuffer);
+	}
+
 	template<typename DataType>
     auto ImplicitAbstractMemoryStructure<DataType>::getMemoryManager() const -> MemoryManagerType*
 	{
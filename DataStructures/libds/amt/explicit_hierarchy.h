@@ -4,6 +4,8 @@
 #include <libds/amt/hierarchy.h>
 #include <libds/amt/implicit_sequence.h>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace ds::amt {
 
@@ -27,6 +29,7 @@ namespace ds::amt {
 	{
 	public:
 		ExplicitHierarchy();
+		explicit ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		ExplicitHierarchy(const ExplicitHierarchy& other);
 
 		AMT& assign(const AMT& other) override;
@@ -54,15 +57,22 @@ namespace ds::amt {
 	struct MultiWayExplicitHierarchyBlock :
 		public ExplicitHierarchyBlock<DataType>
 	{
-		MultiWayExplicitHierarchyBlock() : sons_(new IS<MultiWayExplicitHierarchyBlock<DataType>*>()) {}
-		~MultiWayExplicitHierarchyBlock() { delete sons_; sons_ = nullptr; }
-
-		IS<MultiWayExplicitHierarchyBlock<DataType>*>* sons_;
+		// Most nodes have only a few sons, those are stored in the block itself.
+		SmallIS<MultiWayExplicitHierarchyBlock<DataType>*, 4> sons_;
 	};
 
 	template<typename DataType>
 	using MWEHBlock = MultiWayExplicitHierarchyBlock<DataType>;
 
+	/**
+	 * @brief Order in which compaction places the nodes of a hierarchy, depth first or breadth first.
+	 */
+	enum class CompactionOrder
+	{
+		PreOrder,
+		LevelOrder
+	};
+
 	template<typename DataType>
 	class MultiWayExplicitHierarchy :
 		public ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>
@@ -71,6 +81,7 @@ namespace ds::amt {
 		using BlockType = MultiWayExplicitHierarchyBlock<DataType>;
 
 		MultiWayExplicitHierarchy();
+		explicit MultiWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other);
 		~MultiWayExplicitHierarchy() override;
 
@@ -81,6 +92,25 @@ namespace ds::amt {
 		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
 		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
 		void removeSon(BlockType& parent, size_t sonOrder) override;
+
+		/**
+		 * @brief Moves all nodes in @p order into a new empty manager of the same kind
+		 *        as the current one, which it then replaces.
+		 *
+		 * Nodes end up adjacent only if the manager places them so, e.g. PoolMemoryManager and
+		 * ArenaMemoryManager. The default MemoryManager allocates each node separately, so its
+		 * nodes are moved into a PoolMemoryManager instead.
+		 * Data are moved, son pointers are copied and then redirected to the new nodes.
+		 * Pointers to nodes are invalidated.
+		 */
+		void compact(CompactionOrder order = CompactionOrder::PreOrder);
+
+		/**
+		 * @brief Moves all nodes in @p order into @p memoryManager, which must be empty.
+		 *        It then replaces and takes over from the current memory manager, which is deleted.
+		 *        If an allocation fails, @p memoryManager is deleted and the hierarchy is left unchanged.
+		 */
+		void compact(CompactionOrder order, mm::MemoryManager<BlockType>* memoryManager);
 	};
 
 	template<typename DataType>
@@ -110,6 +140,7 @@ namespace ds::amt {
 		using BlockType = KWayExplicitHierarchyBlock<DataType, K>;
 
 		KWayExplicitHierarchy();
+		explicit KWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		KWayExplicitHierarchy(const KWayExplicitHierarchy& other);
 		~KWayExplicitHierarchy() override;
 
@@ -150,6 +181,7 @@ namespace ds::amt {
 		using BlockType = BinaryExplicitHierarchyBlock<DataType>;
 
 		BinaryExplicitHierarchy();
+		explicit BinaryExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other);
 		~BinaryExplicitHierarchy() override;
 
@@ -191,6 +223,13 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename BlockType>
+	ExplicitHierarchy<BlockType>::ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitAMS<BlockType>(memoryManager),
+		root_(nullptr)
+	{
+	}
+
 	template<typename BlockType>
 	ExplicitHierarchy<BlockType>::ExplicitHierarchy(const ExplicitHierarchy& other) :
 		ExplicitHierarchy()
@@ -236,10 +275,17 @@ namespace ds::amt {
 	template<typename BlockType>
 	void ExplicitHierarchy<BlockType>::clear()
 	{
-		Hierarchy<BlockType>::processPostOrder(root_, [&](BlockType* b)
-			{
-				AMS<BlockType>::memoryManager_->releaseMemory(b);
-			});
+		if (AMS<BlockType>::memoryManager_->releasesInBulk())
+		{
+			AMS<BlockType>::memoryManager_->releaseAllMemory();
+		}
+		else
+		{
+			Hierarchy<BlockType>::processPostOrder(root_, [&](BlockType* b)
+				{
+					AMS<BlockType>::memoryManager_->releaseMemory(b);
+				});
+		}
 		root_ = nullptr;
 	}
 
@@ -345,6 +391,12 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename DataType>
+	MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>(memoryManager)
+	{
+	}
+
 	template<typename DataType>
 	MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other) :
 		ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>()
@@ -361,13 +413,13 @@ namespace ds::amt {
 	template<typename DataType>
 	size_t MultiWayExplicitHierarchy<DataType>::degree(const BlockType& node) const
 	{
-		return node.sons_->size();
+		return node.sons_.size();
 	}
 
 	template<typename DataType>
 	auto MultiWayExplicitHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
 	{
-		MemoryBlock<BlockType*>* sonBlock = node.sons_->access(sonOrder);
+		MemoryBlock<BlockType*>* sonBlock = node.sons_.access(sonOrder);
 		return sonBlock != nullptr ? sonBlock->data_ : nullptr;
 	}
 
@@ -375,7 +427,7 @@ namespace ds::amt {
 	auto MultiWayExplicitHierarchy<DataType>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
 	{
 		BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
-		parent.sons_->insert(sonOrder).data_ = newSon;
+		parent.sons_.insert(sonOrder).data_ = newSon;
 		newSon->parent_ = &parent;
 		return *newSon;
 	}
@@ -383,7 +435,7 @@ namespace ds::amt {
 	template<typename DataType>
 	void MultiWayExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
 	{
-		MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
+		MemoryBlock<BlockType*>* sonBlock = parent.sons_.access(sonOrder);
 
 		BlockType* oldSon = sonBlock->data_;
 		sonBlock->data_ = newSon;
@@ -395,7 +447,7 @@ namespace ds::amt {
 	template<typename DataType>
 	void MultiWayExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
 	{
-		MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
+		MemoryBlock<BlockType*>* sonBlock = parent.sons_.access(sonOrder);
 
 		BlockType* removedSon = sonBlock->data_;
 
@@ -404,7 +456,87 @@ namespace ds::amt {
 				AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(b);
 			});
 
-		parent.sons_->remove(sonOrder);
+		parent.sons_.remove(sonOrder);
+	}
+
+	template<typename DataType>
+	void MultiWayExplicitHierarchy<DataType>::compact(CompactionOrder order)
+	{
+		this->compact(order, AbstractMemoryStructure<BlockType>::memoryManager_->createEmpty(this->size()));
+	}
+
+	template<typename DataType>
+	void MultiWayExplicitHierarchy<DataType>::compact(CompactionOrder order, mm::MemoryManager<BlockType>* newManager)
+	{
+		std::vector<BlockType*> oldNodes;
+		std::vector<BlockType*> newNodes;
+		try
+		{
+			if (order == CompactionOrder::PreOrder)
+			{
+				Hierarchy<BlockType>::processPreOrder(this->root_, [&oldNodes](const BlockType* b)
+					{
+						oldNodes.push_back(const_cast<BlockType*>(b));
+					});
+			}
+			else
+			{
+				Hierarchy<BlockType>::processLevelOrder(this->root_, [&oldNodes](BlockType* b)
+					{
+						oldNodes.push_back(b);
+					});
+			}
+
+			newNodes.reserve(oldNodes.size());
+			for (BlockType* oldNode : oldNodes)
+			{
+				newNodes.push_back(newManager->allocateMemory());
+				newNodes.back()->sons_.assign(oldNode->sons_);
+			}
+		}
+		catch (...)
+		{
+			for (BlockType* newNode : newNodes)
+			{
+				newManager->releaseMemory(newNode);
+			}
+			delete newManager;
+			throw;
+		}
+
+		mm::MemoryManager<BlockType>* oldManager = AbstractMemoryStructure<BlockType>::memoryManager_;
+
+		// Parent of an old node is no longer needed, it forwards to the new node instead.
+		for (size_t i = 0; i < oldNodes.size(); ++i)
+		{
+			newNodes[i]->data_ = std::move(oldNodes[i]->data_);
+			oldNodes[i]->parent_ = newNodes[i];
+		}
+
+		for (BlockType* newNode : newNodes)
+		{
+			for (BlockType*& son : newNode->sons_)
+			{
+				if (son != nullptr)
+				{
+					son = static_cast<BlockType*>(son->parent_);
+					son->parent_ = newNode;
+				}
+			}
+		}
+
+		if (this->root_ != nullptr)
+		{
+			this->root_ = static_cast<BlockType*>(this->root_->parent_);
+			this->root_->parent_ = nullptr;
+		}
+
+		for (BlockType* oldNode : oldNodes)
+		{
+			oldManager->releaseMemory(oldNode);
+		}
+		AbstractMemoryStructure<BlockType>::memoryManager_ = newManager;
+		delete oldManager;
 	}
 
 	template<typename DataType, size_t K>
@@ -413,6 +545,12 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename DataType, size_t K>
+	KWayExplicitHierarchy<DataType, K>::KWayExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>(memoryManager)
+	{
+	}
+
 	template<typename DataType, size_t K>
 	KWayExplicitHierarchy<DataType, K>::KWayExplicitHierarchy(const KWayExplicitHierarchy& other) :
 		ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>()
@@ -489,6 +627,12 @@ namespace ds::amt {
 	{
 	}
 
+	template<typename DataType>
+	BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>(memoryManager)
+	{
+	}
+
 	template<typename DataType>
 	BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other) :
 		ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>()
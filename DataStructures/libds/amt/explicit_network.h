@@ -14,10 +14,8 @@ namespace ds::amt {
 	{
 		using RelationBlockType = typename ImplicitAMS<NetworkBlockImplicitRelations<DataType>*>::BlockType;
 
-		NetworkBlockImplicitRelations() : relations_(new IS<NetworkBlockImplicitRelations<DataType>*>()) {}
-		~NetworkBlockImplicitRelations() { delete relations_; relations_ = nullptr; }
-
-		IS<NetworkBlockImplicitRelations<DataType>*>* relations_;
+		// Most nodes have only a few neighbours, those are stored in the block itself.
+		SmallIS<NetworkBlockImplicitRelations<DataType>*, 4> relations_;
 	};
 
 	template<typename DataType>
@@ -29,10 +27,7 @@ namespace ds::amt {
 	{
 		using RelationBlockType = typename DoublyLS<NetworkBlockExplicitRelations<DataType>*>::BlockType;
 
-		NetworkBlockExplicitRelations() : relations_(new DoublyLS<NetworkBlockExplicitRelations<DataType>*>()) {}
-		~NetworkBlockExplicitRelations() { delete relations_; relations_ = nullptr; }
-
-		DoublyLS<NetworkBlockExplicitRelations<DataType>*>* relations_;
+		DoublyLS<NetworkBlockExplicitRelations<DataType>*> relations_;
 	};
 
 	template<typename DataType>
@@ -133,7 +128,7 @@ namespace ds::amt {
 
 			while (otherBlockFrom != nullptr)
 			{
-				otherBlockFrom->data_->relations_->processAllBlocksForward([&](RelationsBlockType* otherRelationsBlock)
+				otherBlockFrom->data_->relations_.processAllBlocksForward([&](RelationsBlockType* otherRelationsBlock)
 					{
 						size_t otherGateIndexTo = 0;
 						otherExplicitNetwork.gate_->findBlockWithProperty([&](GateBlockType* otherGateBlockIndexTo)->bool
@@ -187,17 +182,17 @@ namespace ds::amt {
 		while (myGateBlock != nullptr)
 		{
 			if (myGateBlock->data_ != otherGateBlock->data_) { return false; }
-			if (myGateBlock->data_->relations_->size() != otherGateBlock->data_->relations_->size()) { return false; }
+			if (myGateBlock->data_->relations_.size() != otherGateBlock->data_->relations_.size()) { return false; }
 
-			RelationsBlockType* myRelationsBlock = myGateBlock->data_->relations_->accessFirst();
-			RelationsBlockType* otherRelationsBlock = otherGateBlock->data_->relations_->accessFirst();
+			RelationsBlockType* myRelationsBlock = myGateBlock->data_->relations_.accessFirst();
+			RelationsBlockType* otherRelationsBlock = otherGateBlock->data_->relations_.accessFirst();
 
 			while (myRelationsBlock != nullptr)
 			{
 				if (myRelationsBlock->data_ != otherRelationsBlock->data_) { return false; }
 
-				myRelationsBlock = myGateBlock->data_->relations_->accessNext(*myRelationsBlock);
-				otherRelationsBlock = otherGateBlock->data_->relations_->accessNext(*otherRelationsBlock);
+				myRelationsBlock = myGateBlock->data_->relations_.accessNext(*myRelationsBlock);
+				otherRelationsBlock = otherGateBlock->data_->relations_.accessNext(*otherRelationsBlock);
 			}
 
 			myGateBlock = gate_->accessNext(*myGateBlock);
@@ -211,14 +206,14 @@ namespace ds::amt {
     size_t ExplicitNetwork<BlockType, GateType>::relationCount() const
 	{
 		size_t result = 0;
-		gate_->processAllBlocksForward([&result](const GateBlockType* b) {result += b->data_->relations_->size(); });
+		gate_->processAllBlocksForward([&result](const GateBlockType* b) {result += b->data_->relations_.size(); });
 		return result;
 	}
 
 	template<typename BlockType, typename GateType>
     size_t ExplicitNetwork<BlockType, GateType>::degree(const BlockType& node) const
 	{
-		return node.relations_->size();
+		return node.relations_.size();
 	}
 
 	template<typename BlockType, typename GateType>
@@ -230,7 +225,7 @@ namespace ds::amt {
 	template<typename BlockType, typename GateType>
     BlockType* ExplicitNetwork<BlockType, GateType>::accessNodeFromNode(const BlockType& node, size_t order) const
 	{
-		return node.relations_->access(order)->data_;
+		return node.relations_.access(order)->data_;
 	}
 
 	template<typename BlockType, typename GateType>
@@ -239,7 +234,7 @@ namespace ds::amt {
 		std::function<bool(const BlockType&, const BlockType&)> relationExists;
 		relationExists = [](const BlockType& vrcholOd, const BlockType& vrcholDo)->bool
 		{
-			return vrcholOd.relations_->findBlockWithProperty([&vrcholDo](RelationsBlockType* b)->bool {return b->data_ == &vrcholDo; }) != nullptr;
+			return vrcholOd.relations_.findBlockWithProperty([&vrcholDo](RelationsBlockType* b)->bool {return b->data_ == &vrcholDo; }) != nullptr;
 		};
 
 		return degree(nodeA) <= degree(nodeB) ? relationExists(nodeA, nodeB) : relationExists(nodeB, nodeA);
@@ -258,7 +253,7 @@ namespace ds::amt {
 	{
 		while (degree(*node) > 0)
 		{
-			disconnect(*node, *node->relations_->accessLast()->data_);
+			disconnect(*node, *node->relations_.accessLast()->data_);
 		}
 
 		GateBlockType* gateBlock = gate_->accessFirst();
@@ -281,28 +276,28 @@ namespace ds::amt {
 	template<typename BlockType, typename GateBlock>
     void ExplicitNetwork<BlockType, GateBlock>::connect(BlockType& nodeA, BlockType& nodeB)
 	{
-		nodeA.relations_->insertLast().data_ = &nodeB;
-		nodeB.relations_->insertLast().data_ = &nodeA;
+		nodeA.relations_.insertLast().data_ = &nodeB;
+		nodeB.relations_.insertLast().data_ = &nodeA;
 	}
 
 	template<typename BlockType, typename GateBlock>
     void ExplicitNetwork<BlockType, GateBlock>::disconnect(BlockType& nodeA, BlockType& nodeB)
 	{
-		std::function<void(const BlockType&, const BlockType&)> disconnectRelation;
-		disconnectRelation = [](const BlockType& nodeFrom, const BlockType& nodeTo)
+		std::function<void(BlockType&, const BlockType&)> disconnectRelation;
+		disconnectRelation = [](BlockType& nodeFrom, const BlockType& nodeTo)
 		{
 
-			if (nodeFrom.relations_->accessFirst()->data_ == &nodeTo)
+			if (nodeFrom.relations_.accessFirst()->data_ == &nodeTo)
 			{
-				nodeFrom.relations_->removeFirst();
+				nodeFrom.relations_.removeFirst();
 			}
 			else
 			{
-				RelationsBlockType* prevInRelationsFrom = nodeFrom.relations_->findPreviousToBlockWithProperty([&nodeTo](RelationsBlockType* b) -> bool
+				RelationsBlockType* prevInRelationsFrom = nodeFrom.relations_.findPreviousToBlockWithProperty([&nodeTo](RelationsBlockType* b) -> bool
 					{
 						return b->data_ == &nodeTo;
 					});
-				nodeFrom.relations_->removeNext(*prevInRelationsFrom);
+				nodeFrom.relations_.removeNext(*prevInRelationsFrom);
 			}
 		};
 
@@ -2,6 +2,8 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/sequence.h>
+#include <utility>
+#include <vector>
 
 namespace ds::amt {
 
@@ -12,6 +14,7 @@ namespace ds::amt {
     {
     public:
         ExplicitSequence();
+        explicit ExplicitSequence(mm::MemoryManager<BlockType>* memoryManager);
         ExplicitSequence(const ExplicitSequence& other);
         ~ExplicitSequence() override;
 
@@ -39,6 +42,24 @@ namespace ds::amt {
         void removeNext(const BlockType& block) override;
         void removePrevious(const BlockType& block) override;
 
+        /**
+         * @brief Moves all blocks in sequence order into a new empty manager of the same kind
+         *        as the current one, which it then replaces.
+         *
+         * Blocks end up adjacent only if the manager places them so, e.g. PoolMemoryManager and
+         * ArenaMemoryManager. The default MemoryManager allocates each block separately, so its
+         * blocks are moved into a PoolMemoryManager instead.
+         * Data are moved, not copied. Pointers to blocks are invalidated.
+         */
+        void compact();
+
+        /**
+         * @brief Moves all blocks in sequence order into @p memoryManager, which must be empty.
+         *        It then replaces and takes over from the current memory manager, which is deleted.
+         *        If an allocation fails, @p memoryManager is deleted and the sequence is left unchanged.
+         */
+        void compact(mm::MemoryManager<BlockType>* memoryManager);
+
     protected:
         virtual void connectBlocks(BlockType* previous, BlockType* next);
         virtual void disconnectBlock(BlockType* block);
@@ -94,6 +115,9 @@ namespace ds::amt {
     {
     public:
         using BlockType = SinglyLinkedSequenceBlock<DataType>;
+
+        SinglyLinkedSequence() = default;
+        explicit SinglyLinkedSequence(mm::MemoryManager<BlockType>* memoryManager) : ES<BlockType>(memoryManager) {}
     };
 
     template<typename DataType>
@@ -131,6 +155,9 @@ namespace ds::amt {
     public:
         using BlockType = DLSBlock<DataType>;
 
+        DoublyLinkedSequence() = default;
+        explicit DoublyLinkedSequence(mm::MemoryManager<BlockType>* memoryManager) : ES<BlockType>(memoryManager) {}
+
         BlockType* access(size_t index) const override;
         BlockType* accessPrevious(const BlockType& block) const override;
 
@@ -164,6 +191,14 @@ namespace ds::amt {
     {
     }
 
+    template<typename BlockType>
+    ExplicitSequence<BlockType>::ExplicitSequence(mm::MemoryManager<BlockType>* memoryManager) :
+        ExplicitAMS<BlockType>(memoryManager),
+        first_(nullptr),
+        last_(nullptr)
+    {
+    }
+
     template<typename BlockType>
     ExplicitSequence<BlockType>::ExplicitSequence(const ExplicitSequence& other) :
         ExplicitSequence()
@@ -197,6 +232,14 @@ namespace ds::amt {
     template<typename BlockType>
     void ExplicitSequence<BlockType>::clear()
     {
+        if (AMS<BlockType>::memoryManager_->releasesInBulk())
+        {
+            AMS<BlockType>::memoryManager_->releaseAllMemory();
+            first_ = nullptr;
+            last_ = nullptr;
+            return;
+        }
+
         last_ = first_;
 
         while (first_ != nullptr)
@@ -447,6 +490,55 @@ namespace ds::amt {
         }
     }
 
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::compact()
+    {
+        this->compact(AMS<BlockType>::memoryManager_->createEmpty(this->size()));
+    }
+
+    template<typename BlockType>
+    void ExplicitSequence<BlockType>::compact(mm::MemoryManager<BlockType>* newManager)
+    {
+        mm::MemoryManager<BlockType>* oldManager = AMS<BlockType>::memoryManager_;
+
+        std::vector<BlockType*> newBlocks;
+        try
+        {
+            newBlocks.reserve(this->size());
+            for (size_t i = 0; i < this->size(); ++i)
+            {
+                newBlocks.push_back(newManager->allocateMemory());
+            }
+        }
+        catch (...)
+        {
+            for (BlockType* newBlock : newBlocks)
+            {
+                newManager->releaseMemory(newBlock);
+            }
+            delete newManager;
+            throw;
+        }
+
+        BlockType* previous = nullptr;
+        BlockType* block = first_;
+        for (BlockType* newBlock : newBlocks)
+        {
+            newBlock->data_ = std::move(block->data_);
+            this->connectBlocks(previous, newBlock);
+            previous = newBlock;
+
+            BlockType* next = this->accessNext(*block);
+            oldManager->releaseMemory(block);
+            block = next;
+        }
+
+        first_ = newBlocks.empty() ? nullptr : newBlocks.front();
+        last_ = previous;
+        AMS<BlockType>::memoryManager_ = newManager;
+        delete oldManager;
+    }
+
     template<typename BlockType>
     void ExplicitSequence<BlockType>::connectBlocks(BlockType* previous, BlockType* next)
     {
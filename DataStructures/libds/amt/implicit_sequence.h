@@ -2,6 +2,7 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/sequence.h>
+#include <libds/mm/small_compact_memory_manager.h>
 
 namespace ds::amt {
 
@@ -16,6 +17,7 @@ namespace ds::amt {
 
 		ImplicitSequence() = default;
 		ImplicitSequence(size_t capacity, bool initBlocks);
+		explicit ImplicitSequence(MemoryManagerType* memoryManager);
 		ImplicitSequence(const ImplicitSequence<DataType>& other);
 		~ImplicitSequence() override = default;
 
@@ -41,6 +43,12 @@ namespace ds::amt {
 
 		void reserveCapacity(size_t capacity);
 
+		/**
+		 * @brief Closes a gap of the gap buffer layout, so that the blocks are adjacent starting
+		 *        at accessFirst() and may be walked by pointer arithmetic. Pointers to blocks are invalidated.
+		 */
+		void makeContiguous();
+
 		virtual size_t indexOfNext(size_t currentIndex) const;
 		virtual size_t indexOfPrevious(size_t currentIndex) const;
 
@@ -88,12 +96,50 @@ namespace ds::amt {
 
 	//----------
 
+	/**
+	 * @brief Holds the memory manager of SmallImplicitSequence, a base so that the manager
+	 *        is constructed before the sequence uses it.
+	 */
+	template<typename DataType, size_t InlineCapacity>
+	struct SmallImplicitSequenceStorage
+	{
+		mm::SmallCompactMemoryManager<MemoryBlock<DataType>, InlineCapacity> inlineMemoryManager_;
+	};
+
+	/**
+	 * @brief Implicit sequence storing up to InlineCapacity elements in itself, it allocates
+	 *        memory only when it grows beyond them.
+	 */
+	template<typename DataType, size_t InlineCapacity>
+	class SmallImplicitSequence :
+		private SmallImplicitSequenceStorage<DataType, InlineCapacity>,
+		public IS<DataType>
+	{
+	public:
+		SmallImplicitSequence();
+		SmallImplicitSequence(const SmallImplicitSequence<DataType, InlineCapacity>& other);
+		~SmallImplicitSequence() override;
+
+		bool isInline() const;
+	};
+
+	template<typename DataType, size_t InlineCapacity>
+	using SmallIS = SmallImplicitSequence<DataType, InlineCapacity>;
+
+	//----------
+
 	template<typename DataType>
     ImplicitSequence<DataType>::ImplicitSequence(size_t initialSize, bool initBlocks):
 		ImplicitAMS<DataType>(initialSize, initBlocks)
 	{
 	}
 
+	template<typename DataType>
+    ImplicitSequence<DataType>::ImplicitSequence(MemoryManagerType* memoryManager):
+		ImplicitAMS<DataType>(memoryManager)
+	{
+	}
+
 	template<typename DataType>
     ImplicitSequence<DataType>::ImplicitSequence(const ImplicitSequence<DataType>& other):
 		ImplicitAMS<DataType>::ImplicitAbstractMemoryStructure(other)
@@ -215,6 +261,12 @@ namespace ds::amt {
 		this->getMemoryManager()->changeCapacity(capacity);
 	}
 
+	template<typename DataType>
+    void ImplicitSequence<DataType>::makeContiguous()
+	{
+		this->getMemoryManager()->makeContiguous();
+	}
+
 	template<typename DataType>
     size_t ImplicitSequence<DataType>::indexOfNext(size_t currentIndex) const
 	{
@@ -306,17 +358,50 @@ namespace ds::amt {
 	template<typename DataType>
     size_t CyclicImplicitSequence<DataType>::indexOfNext(size_t currentIndex) const
 	{
-		// TODO 03
-		// po implementacii vymazte vyhodenie vynimky!
-		throw std::runtime_error("Not implemented yet");
+		const size_t size = this->size();
+		return size == 0
+			? INVALID_INDEX
+			: currentIndex >= size - 1
+			? 0
+			: currentIndex + 1;
 	}
 
 	template<typename DataType>
     size_t CyclicImplicitSequence<DataType>::indexOfPrevious(size_t currentIndex) const
 	{
-		// TODO 03
-		// po implementacii vymazte vyhodenie vynimky!
-		throw std::runtime_error("Not implemented yet");
+		const size_t size = this->size();
+		return size == 0
+			? INVALID_INDEX
+			: currentIndex == 0
+			? size - 1
+			: currentIndex - 1;
+	}
+
+	template<typename DataType, size_t InlineCapacity>
+    SmallImplicitSequence<DataType, InlineCapacity>::SmallImplicitSequence():
+		SmallImplicitSequenceStorage<DataType, InlineCapacity>(),
+		IS<DataType>(&this->inlineMemoryManager_)
+	{
+	}
+
+	template<typename DataType, size_t InlineCapacity>
+    SmallImplicitSequence<DataType, InlineCapacity>::SmallImplicitSequence(const SmallImplicitSequence<DataType, InlineCapacity>& other):
+		SmallImplicitSequence()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType, size_t InlineCapacity>
+    SmallImplicitSequence<DataType, InlineCapacity>::~SmallImplicitSequence()
+	{
+		// The manager is a member, it must not be deleted by AbstractMemoryStructure.
+		this->memoryManager_ = nullptr;
+	}
+
+	template<typename DataType, size_t InlineCapacity>
+    bool SmallImplicitSequence<DataType, InlineCapacity>::isInline() const
+	{
+		return this->inlineMemoryManager_.isInline();
 	}
 
 }
\ No newline at end of file
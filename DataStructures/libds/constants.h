@@ -6,4 +6,5 @@
 namespace ds
 {
     const size_t INVALID_INDEX = (std::numeric_limits<size_t>::max)();
+    const size_t CACHE_LINE_SIZE = 64;
 }
\ No newline at end of file
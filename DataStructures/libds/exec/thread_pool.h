@@ -0,0 +1,339 @@
+#pragma once
+
+#include <libds/adt/queue.h>
+#include <libds/constants.h>
+#include <libds/exec/work_stealing_deque.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ds::exec {
+
+    /**
+     * @brief Fork/join thread pool with one work-stealing deque per worker.
+     *
+     * Tasks spawned by a worker go to the bottom of its own deque, tasks submitted
+     * from other threads go to a shared injection queue. Idle workers steal from the
+     * top of other deques. A thread waiting in invoke keeps executing other tasks,
+     * so nested parallelism does not block workers.
+     */
+    class ThreadPool
+    {
+    public:
+        ThreadPool();
+        explicit ThreadPool(size_t threadCount);
+        ThreadPool(const ThreadPool& other) = delete;
+        ThreadPool& operator=(const ThreadPool& other) = delete;
+        ~ThreadPool();
+
+        size_t getThreadCount() const;
+
+        /**
+         * @brief Schedules @p function and returns a future of its result.
+         * Waiting on the future from a worker blocks it; use invoke for fork/join.
+         */
+        template<typename F>
+        auto submit(F function) -> std::future<std::invoke_result_t<F>>;
+
+        /**
+         * @brief Calls @p function(i) for each i in [@p begin, @p end), splitting the range
+         *        in halves until chunks have at most @p grain indices.
+         */
+        template<typename F>
+        void parallelFor(size_t begin, size_t end, size_t grain, F function);
+
+        /**
+         * @brief Runs @p a and @p b potentially in parallel and returns when both finished.
+         * An exception thrown by either is rethrown after both finished.
+         */
+        template<typename A, typename B>
+        void invoke(A a, B b);
+
+        /**
+         * @brief Returns the pool shared by all parallel algorithms of the library.
+         */
+        static ThreadPool& getDefault();
+
+    private:
+        struct Task
+        {
+            std::function<void()> function_;
+        };
+
+    private:
+        template<typename F>
+        void parallelForRange(size_t begin, size_t end, size_t grain, F& function);
+
+        void schedule(Task* task);
+        Task* findTask();
+        bool runPendingTask();
+        void workerLoop(size_t index);
+
+    private:
+        std::vector<std::unique_ptr<WorkStealingDeque<Task>>> deques_;
+        std::vector<std::thread> workers_;
+
+        std::mutex mutex_;
+        std::condition_variable wakeUp_;
+        adt::ImplicitQueue<Task*> injectedTasks_;
+        bool stopping_;
+
+        std::atomic<size_t> injectedTaskCount_;
+        std::atomic<size_t> pendingTaskCount_;
+        std::atomic<size_t> sleepingWorkerCount_;
+
+        inline static thread_local ThreadPool* currentPool_ = nullptr;
+        inline static thread_local size_t currentWorker_ = INVALID_INDEX;
+    };
+
+    //----------
+
+    inline ThreadPool::ThreadPool() :
+        ThreadPool((std::max)(1u, std::thread::hardware_concurrency()))
+    {
+    }
+
+    inline ThreadPool::ThreadPool(size_t threadCount) :
+        stopping_(false),
+        injectedTaskCount_(0),
+        pendingTaskCount_(0),
+        sleepingWorkerCount_(0)
+    {
+        threadCount = (std::max)(threadCount, static_cast<size_t>(1));
+
+        deques_.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            deques_.push_back(std::make_unique<WorkStealingDeque<Task>>());
+        }
+
+        workers_.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            workers_.emplace_back([this, i]()
+                {
+                    this->workerLoop(i);
+                });
+        }
+    }
+
+    inline ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wakeUp_.notify_all();
+
+        for (std::thread& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    inline size_t ThreadPool::getThreadCount() const
+    {
+        return workers_.size();
+    }
+
+    template<typename F>
+    auto ThreadPool::submit(F function) -> std::future<std::invoke_result_t<F>>
+    {
+        using ResultType = std::invoke_result_t<F>;
+
+        auto packagedTask = std::make_shared<std::packaged_task<ResultType()>>(std::move(function));
+        std::future<ResultType> result = packagedTask->get_future();
+        this->schedule(new Task{ [packagedTask]() { (*packagedTask)(); } });
+        return result;
+    }
+
+    template<typename F>
+    void ThreadPool::parallelFor(size_t begin, size_t end, size_t grain, F function)
+    {
+        this->parallelForRange(begin, end, (std::max)(grain, static_cast<size_t>(1)), function);
+    }
+
+    template<typename F>
+    void ThreadPool::parallelForRange(size_t begin, size_t end, size_t grain, F& function)
+    {
+        if (end <= begin + grain)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                function(i);
+            }
+            return;
+        }
+
+        const size_t middle = begin + (end - begin) / 2;
+        this->invoke(
+            [this, begin, middle, grain, &function]() { this->parallelForRange(begin, middle, grain, function); },
+            [this, middle, end, grain, &function]() { this->parallelForRange(middle, end, grain, function); }
+        );
+    }
+
+    template<typename A, typename B>
+    void ThreadPool::invoke(A a, B b)
+    {
+        std::atomic<bool> forkedDone(false);
+        std::exception_ptr forkedException;
+        std::exception_ptr inlineException;
+
+        this->schedule(new Task{ [&b, &forkedDone, &forkedException]()
+            {
+                try
+                {
+                    b();
+                }
+                catch (...)
+                {
+                    forkedException = std::current_exception();
+                }
+                forkedDone.store(true, std::memory_order_release);
+            } });
+
+        try
+        {
+            a();
+        }
+        catch (...)
+        {
+            inlineException = std::current_exception();
+        }
+
+        // The forked task refers to this frame, so it must finish even if a threw.
+        while (!forkedDone.load(std::memory_order_acquire))
+        {
+            if (!this->runPendingTask())
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (inlineException)
+        {
+            std::rethrow_exception(inlineException);
+        }
+        if (forkedException)
+        {
+            std::rethrow_exception(forkedException);
+        }
+    }
+
+    inline ThreadPool& ThreadPool::getDefault()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    inline void ThreadPool::schedule(Task* task)
+    {
+        pendingTaskCount_.fetch_add(1);
+
+        if (currentPool_ == this)
+        {
+            deques_[currentWorker_]->push(task);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            injectedTasks_.push(task);
+            injectedTaskCount_.fetch_add(1);
+        }
+
+        if (sleepingWorkerCount_.load() > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+            }
+            wakeUp_.notify_one();
+        }
+    }
+
+    inline ThreadPool::Task* ThreadPool::findTask()
+    {
+        const size_t self = currentPool_ == this ? currentWorker_ : INVALID_INDEX;
+        Task* task = nullptr;
+
+        if (self != INVALID_INDEX)
+        {
+            task = deques_[self]->take();
+        }
+
+        if (task == nullptr && injectedTaskCount_.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!injectedTasks_.isEmpty())
+            {
+                task = injectedTasks_.pop();
+                injectedTaskCount_.fetch_sub(1);
+            }
+        }
+
+        const size_t dequeCount = deques_.size();
+        for (size_t i = 1; task == nullptr && i <= dequeCount; ++i)
+        {
+            const size_t victim = self == INVALID_INDEX ? i - 1 : (self + i) % dequeCount;
+            if (victim != self)
+            {
+                task = deques_[victim]->steal();
+            }
+        }
+
+        if (task != nullptr)
+        {
+            pendingTaskCount_.fetch_sub(1);
+        }
+
+        return task;
+    }
+
+    inline bool ThreadPool::runPendingTask()
+    {
+        Task* task = this->findTask();
+        if (task == nullptr)
+        {
+            return false;
+        }
+
+        task->function_();
+        delete task;
+        return true;
+    }
+
+    inline void ThreadPool::workerLoop(size_t index)
+    {
+        currentPool_ = this;
+        currentWorker_ = index;
+
+        for (;;)
+        {
+            if (this->runPendingTask())
+            {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            sleepingWorkerCount_.fetch_add(1);
+            wakeUp_.wait(lock, [this]()
+                {
+                    return stopping_ || pendingTaskCount_.load() > 0;
+                });
+            sleepingWorkerCount_.fetch_sub(1);
+
+            if (stopping_ && pendingTaskCount_.load() == 0)
+            {
+                return;
+            }
+        }
+    }
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <libds/constants.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace ds::exec {
+
+    /**
+     * @brief Chase-Lev work-stealing deque of pointers.
+     *
+     * The owner thread pushes and takes at the bottom (LIFO), any other thread steals
+     * at the top (FIFO). The ring grows when full; retired rings are kept until the
+     * deque is destroyed because a thief may still be reading from them.
+     * Memory orderings follow Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+     */
+    template<typename T>
+    class WorkStealingDeque
+    {
+    public:
+        WorkStealingDeque();
+        explicit WorkStealingDeque(size_t capacity);
+        WorkStealingDeque(const WorkStealingDeque& other) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+        ~WorkStealingDeque();
+
+        bool isEmpty() const;
+
+        void push(T* item);
+        T* take();
+        T* steal();
+
+        static const size_t INIT_CAPACITY = 256;
+
+    private:
+        struct Ring
+        {
+            explicit Ring(size_t capacity);
+            ~Ring();
+
+            T* get(std::int64_t index) const;
+            void put(std::int64_t index, T* item);
+            Ring* grow(std::int64_t bottom, std::int64_t top) const;
+
+            std::atomic<T*>* items_;
+            std::int64_t mask_;
+        };
+
+    private:
+        alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> top_;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::int64_t> bottom_;
+        std::atomic<Ring*> ring_;
+        std::vector<Ring*> retiredRings_;
+    };
+
+    //----------
+
+    template<typename T>
+    WorkStealingDeque<T>::Ring::Ring(size_t capacity) :
+        items_(new std::atomic<T*>[capacity]),
+        mask_(static_cast<std::int64_t>(capacity) - 1)
+    {
+    }
+
+    template<typename T>
+    WorkStealingDeque<T>::Ring::~Ring()
+    {
+        delete[] items_;
+        items_ = nullptr;
+    }
+
+    template<typename T>
+    T* WorkStealingDeque<T>::Ring::get(std::int64_t index) const
+    {
+        return items_[index & mask_].load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::Ring::put(std::int64_t index, T* item)
+    {
+        items_[index & mask_].store(item, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    typename WorkStealingDeque<T>::Ring* WorkStealingDeque<T>::Ring::grow(std::int64_t bottom, std::int64_t top) const
+    {
+        Ring* result = new Ring(2 * static_cast<size_t>(mask_ + 1));
+        for (std::int64_t i = top; i < bottom; ++i)
+        {
+            result->put(i, this->get(i));
+        }
+        return result;
+    }
+
+    //----------
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque() :
+        WorkStealingDeque(INIT_CAPACITY)
+    {
+    }
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) :
+        top_(0),
+        bottom_(0),
+        ring_(nullptr)
+    {
+        size_t roundedCapacity = 2;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+        ring_.store(new Ring(roundedCapacity), std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    WorkStealingDeque<T>::~WorkStealingDeque()
+    {
+        delete ring_.load(std::memory_order_relaxed);
+        for (Ring* ring : retiredRings_)
+        {
+            delete ring;
+        }
+    }
+
+    template<typename T>
+    bool WorkStealingDeque<T>::isEmpty() const
+    {
+        const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom <= top;
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::push(T* item)
+    {
+        const std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const std::int64_t top = top_.load(std::memory_order_acquire);
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+
+        if (bottom - top > ring->mask_)
+        {
+            retiredRings_.push_back(ring);
+            ring = ring->grow(bottom, top);
+            ring_.store(ring, std::memory_order_release);
+        }
+
+        ring->put(bottom, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    T* WorkStealingDeque<T>::take()
+    {
+        const std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        T* item = ring->get(bottom);
+        if (top == bottom)
+        {
+            // Last item, race against thieves.
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                item = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    template<typename T>
+    T* WorkStealingDeque<T>::steal()
+    {
+        std::int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        Ring* ring = ring_.load(std::memory_order_acquire);
+        T* item = ring->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return item;
+    }
+}
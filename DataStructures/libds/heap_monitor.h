@@ -18,6 +18,15 @@ T* placement_copy(T* address, const T& origin)
 	return new (address) T(origin);
 }
 
+/**
+ * @brief Creates move-constructed object from @p origin at @p address.
+ */
+template<typename T>
+T* placement_move(T* address, T& origin)
+{
+	return new (address) T(static_cast<T&&>(origin));
+}
+
 /**
  * @brief Explicitly calls destructor of the object living at @p address.
  */
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <libds/mm/memory_manager.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace ds::mm {
+
+    /**
+     * @brief Monotonic memory manager for structures that are built once and torn down at once.
+     *
+     * Blocks are bump-allocated from chunks that double from the initial chunk size up to
+     * MAX_CHUNK_SIZE blocks. Releasing a block only updates the count, neither its memory is
+     * reused nor it is destroyed. All blocks ever allocated are destroyed and all chunks are freed
+     * together by reset() or the destructor; for trivially destructible blocks this takes O(chunks).
+     * Structures owning an arena call reset() from clear() instead of releasing their blocks one by one.
+     */
+    template<typename BlockType>
+    class ArenaMemoryManager : public MemoryManager<BlockType> {
+        static_assert(alignof(BlockType) <= alignof(std::max_align_t), "Chunks are only aligned for fundamental types.");
+
+    public:
+        ArenaMemoryManager();
+        explicit ArenaMemoryManager(size_t chunkSize);
+        ArenaMemoryManager(const ArenaMemoryManager<BlockType>& other) = delete;
+        ArenaMemoryManager<BlockType>& operator=(const ArenaMemoryManager<BlockType>& other) = delete;
+        ~ArenaMemoryManager() override;
+
+        BlockType* allocateMemory() override;
+        void releaseMemory(BlockType* pointer) override;
+
+        /**
+         * @brief Destroys all blocks and frees all chunks. Blocks must not be accessed afterwards.
+         */
+        void reset();
+
+        bool releasesInBulk() const override;
+        void releaseAllMemory() override;
+
+        /**
+         * @brief Returns the number of blocks that fit into all chunks.
+         */
+        size_t getCapacity() const;
+        size_t getChunkCount() const;
+        size_t getAllocatedCapacitySize() const override;
+
+        /**
+         * @brief Returns a new arena whose first chunk holds @p blockCount blocks.
+         */
+        MemoryManager<BlockType>* createEmpty(size_t blockCount) const override;
+
+    private:
+        struct Chunk
+        {
+            BlockType* base_;
+            size_t size_;
+        };
+
+        void addChunk();
+
+    private:
+        std::vector<Chunk> chunks_;
+        BlockType* end_;
+        BlockType* limit_;
+        size_t initChunkSize_;
+        size_t nextChunkSize_;
+        size_t capacity_;
+
+        static const size_t INIT_CHUNK_SIZE = 64;
+        static const size_t MAX_CHUNK_SIZE = 4096;
+    };
+
+    template<typename BlockType>
+    ArenaMemoryManager<BlockType>::ArenaMemoryManager() :
+        ArenaMemoryManager(INIT_CHUNK_SIZE)
+    {
+    }
+
+    template<typename BlockType>
+    ArenaMemoryManager<BlockType>::ArenaMemoryManager(size_t chunkSize) :
+        end_(nullptr),
+        limit_(nullptr),
+        initChunkSize_(std::max<size_t>(chunkSize, 1)),
+        nextChunkSize_(initChunkSize_),
+        capacity_(0)
+    {
+    }
+
+    template<typename BlockType>
+    ArenaMemoryManager<BlockType>::~ArenaMemoryManager()
+    {
+        this->reset();
+    }
+
+    template<typename BlockType>
+    BlockType* ArenaMemoryManager<BlockType>::allocateMemory()
+    {
+        if (end_ == limit_)
+        {
+            this->addChunk();
+        }
+
+        this->countAllocations();
+        return placement_new(end_++);
+    }
+
+    template<typename BlockType>
+    void ArenaMemoryManager<BlockType>::releaseMemory(BlockType* /*pointer*/)
+    {
+        this->countReleases();
+    }
+
+    template<typename BlockType>
+    void ArenaMemoryManager<BlockType>::reset()
+    {
+        for (const Chunk& chunk : chunks_)
+        {
+            if constexpr (!std::is_trivially_destructible_v<BlockType>)
+            {
+                // Only the last chunk may be partially used.
+                BlockType* const used = chunk.base_ + chunk.size_ == limit_ ? end_ : chunk.base_ + chunk.size_;
+                for (BlockType* block = chunk.base_; block != used; ++block)
+                {
+                    destroy(block);
+                }
+            }
+            std::free(chunk.base_);
+        }
+
+        chunks_.clear();
+        end_ = nullptr;
+        limit_ = nullptr;
+        nextChunkSize_ = initChunkSize_;
+        capacity_ = 0;
+        this->countReleases(this->allocatedBlockCount_);
+    }
+
+    template<typename BlockType>
+    bool ArenaMemoryManager<BlockType>::releasesInBulk() const
+    {
+        return true;
+    }
+
+    template<typename BlockType>
+    void ArenaMemoryManager<BlockType>::releaseAllMemory()
+    {
+        this->reset();
+    }
+
+    template<typename BlockType>
+    size_t ArenaMemoryManager<BlockType>::getCapacity() const
+    {
+        return capacity_;
+    }
+
+    template<typename BlockType>
+    size_t ArenaMemoryManager<BlockType>::getChunkCount() const
+    {
+        return chunks_.size();
+    }
+
+    template<typename BlockType>
+    size_t ArenaMemoryManager<BlockType>::getAllocatedCapacitySize() const
+    {
+        return capacity_ * sizeof(BlockType);
+    }
+
+    template<typename BlockType>
+    MemoryManager<BlockType>* ArenaMemoryManager<BlockType>::createEmpty(size_t blockCount) const
+    {
+        return new ArenaMemoryManager<BlockType>(blockCount);
+    }
+
+    template<typename BlockType>
+    void ArenaMemoryManager<BlockType>::addChunk()
+    {
+        const size_t chunkSize = nextChunkSize_;
+        chunks_.reserve(chunks_.size() + 1);
+        BlockType* base = static_cast<BlockType*>(std::malloc(chunkSize * sizeof(BlockType)));
+        if (base == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        chunks_.push_back({ base, chunkSize });
+        end_ = base;
+        limit_ = base + chunkSize;
+        capacity_ += chunkSize;
+        nextChunkSize_ = std::max(chunkSize, std::min(2 * chunkSize, static_cast<size_t>(MAX_CHUNK_SIZE)));
+    }
+}
@@ -4,14 +4,97 @@
 #include <libds/mm/memory_omanip.h>
 #include <libds/constants.h>
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <new>
 #include <ostream>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#include <fstream>
+#include <string>
+#define DS_COMPACT_MEMORY_MREMAP
+#endif
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
 namespace ds::mm {
 
+    /**
+     * @brief Describes how much CompactMemoryManager grows when it is full.
+     *
+     * The capacity is multiplied by factor_, but it grows by at least minStep_
+     * and at most maxStep_ blocks.
+     */
+    struct GrowthPolicy
+    {
+        double factor_ = 2.0;
+        size_t minStep_ = 4;
+        size_t maxStep_ = std::numeric_limits<size_t>::max();
+
+        size_t nextCapacity(size_t capacity) const;
+    };
+
+    /**
+     * @brief Kind of memory a buffer of CompactMemoryManager was allocated from.
+     */
+    enum class StorageBackend
+    {
+        Heap,
+        AlignedHeap,
+        Mapped,
+        HugePages,
+        Inline
+    };
+
+    /**
+     * @brief Describes where CompactMemoryManager allocates its buffer.
+     *
+     * On Linux, buffers of at least mapThreshold_ bytes of trivially relocatable blocks are
+     * anonymous mappings, advised to use transparent huge pages if hugePages_ is set and
+     * prefaulted if populate_ is set. Other buffers are allocated by calloc.
+     *
+     * Every buffer starts at a multiple of alignment_ bytes, or of the alignment of the blocks
+     * if it is larger. A power of two larger than the alignment guaranteed by calloc, e.g.
+     * CACHE_LINE_SIZE, makes heap buffers allocated as aligned ones, which realloc cannot resize.
+     */
+    struct StoragePolicy
+    {
+        size_t mapThreshold_ = size_t{ 4 } << 20;
+        bool hugePages_ = true;
+        bool populate_ = false;
+        size_t alignment_ = 0;
+    };
+
+    /**
+     * @brief Tells whether blocks of type @p BlockType may be moved in memory bytewise.
+     *
+     * Specialize it for types that are not trivially copyable but may still be moved by realloc.
+     */
+    template<typename BlockType>
+    struct IsTriviallyRelocatable : std::is_trivially_copyable<BlockType>
+    {
+    };
+
+    /**
+     * @brief Block padded to a whole number of cache lines, so that neighbouring blocks,
+     *        e.g. counters of different threads, never share one.
+     */
+    template<typename DataType, size_t Alignment = CACHE_LINE_SIZE>
+    struct alignas(Alignment) PaddedBlock
+    {
+        DataType data_;
+    };
+
     template<typename BlockType>
     class CompactMemoryManager : public MemoryManager<BlockType> {
     public:
@@ -27,6 +110,51 @@ namespace ds::mm {
         void releaseMemory();
 
         size_t getCapacity() const;
+        size_t getAllocatedCapacitySize() const override;
+
+        /**
+         * @brief Returns a new manager with the same policies and a capacity of @p blockCount blocks.
+         */
+        MemoryManager<BlockType>* createEmpty(size_t blockCount) const override;
+
+        const GrowthPolicy& getGrowthPolicy() const;
+        void setGrowthPolicy(const GrowthPolicy& growthPolicy);
+
+        /**
+         * @brief Returns the storage policy. A new policy applies to buffers allocated afterwards.
+         */
+        const StoragePolicy& getStoragePolicy() const;
+        void setStoragePolicy(const StoragePolicy& storagePolicy);
+
+        /**
+         * @brief Returns the backend the current buffer was allocated from.
+         */
+        StorageBackend getStorageBackend() const;
+
+        /**
+         * @brief Returns the size of pages the current buffer was advised to use.
+         */
+        size_t getPageSize() const;
+
+        /**
+         * @brief Returns the alignment of the buffer in bytes.
+         */
+        size_t getAlignment() const;
+
+        /**
+         * @brief Turns the gap buffer layout on or off.
+         *
+         * In the gap buffer layout the free capacity forms a gap that follows the index of the last
+         * insertion or removal, so clustered edits only move the blocks between consecutive edits.
+         * Blocks behind the gap are not adjacent to the blocks in front of it.
+         */
+        void setGapBuffer(bool gapBuffer);
+        bool isGapBuffer() const;
+
+        /**
+         * @brief Moves the gap to the nearer end, so that all blocks are adjacent starting at getBlockAt(0).
+         */
+        void makeContiguous();
 
         CompactMemoryManager<BlockType>& assign(const CompactMemoryManager<BlockType>& other);
         void changeCapacity(size_t newCapacity);
@@ -36,22 +164,63 @@ namespace ds::mm {
         void* calculateAddress(const BlockType& data);
         size_t calculateIndex(const BlockType& data);
         BlockType& getBlockAt(size_t index);
+        const BlockType& getBlockAt(size_t index) const;
         void swap(size_t index1, size_t index2);
 
         void print(std::ostream& os);
 
+    protected:
+        /**
+         * @brief Starts with @p buffer of @p capacity blocks owned by a derived manager. The buffer
+         *        is never freed, growing beyond it moves the blocks to the heap.
+         */
+        CompactMemoryManager(BlockType* buffer, size_t capacity);
+
     private:
         size_t getAllocatedBlocksSize() const;
-        size_t getAllocatedCapacitySize() const;
+
+        bool shouldMap(size_t capacity) const;
+        BlockType* allocateStorage(size_t capacity, StorageBackend& backend) const;
+        void adviseStorage(BlockType* base, size_t capacity, StorageBackend& backend) const;
+        void reallocateStorage(size_t newCapacity);
+        static void freeStorage(BlockType* base, size_t capacity, StorageBackend backend);
+
+        bool isOverAligned() const;
+        static size_t getSystemPageSize();
+        static size_t getHugePageSize();
+
+        void moveGap(size_t index);
+        void closeGap();
 
     private:
         BlockType* base_;
         BlockType* end_;
         BlockType* limit_;
+        GrowthPolicy growthPolicy_;
+        StoragePolicy storagePolicy_;
+        StorageBackend backend_;
+
+        // Blocks from gapIndex_ on are stored gapSize_ places further, end_ is behind the last of them.
+        bool gapBuffer_;
+        size_t gapIndex_;
+        size_t gapSize_;
 
         static const size_t INIT_SIZE = 4;
     };
 
+    inline size_t GrowthPolicy::nextCapacity(size_t capacity) const
+    {
+        const double step = static_cast<double>(capacity) * (factor_ - 1.0);
+        const size_t maxStep = std::max<size_t>(maxStep_, 1);
+        const size_t minStep = std::min(std::max<size_t>(minStep_, 1), maxStep);
+        const size_t boundedStep = step >= static_cast<double>(maxStep)
+            ? maxStep
+            : std::max(minStep, static_cast<size_t>(step));
+        return boundedStep > std::numeric_limits<size_t>::max() - capacity
+            ? std::numeric_limits<size_t>::max()
+            : capacity + boundedStep;
+    }
+
     template<typename BlockType>
     CompactMemoryManager<BlockType>::CompactMemoryManager() :
         CompactMemoryManager(INIT_SIZE)
@@ -60,9 +229,28 @@ namespace ds::mm {
 
     template<typename BlockType>
     CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size) :
-        base_(static_cast<BlockType*>(std::calloc(size, sizeof(BlockType)))),
-        end_(base_),
-        limit_(base_ + size)
+        base_(nullptr),
+        end_(nullptr),
+        limit_(nullptr),
+        backend_(StorageBackend::Heap),
+        gapBuffer_(false),
+        gapIndex_(0),
+        gapSize_(0)
+    {
+        base_ = this->allocateStorage(size, backend_);
+        end_ = base_;
+        limit_ = base_ + size;
+    }
+
+    template<typename BlockType>
+    CompactMemoryManager<BlockType>::CompactMemoryManager(BlockType* buffer, size_t capacity) :
+        base_(buffer),
+        end_(buffer),
+        limit_(buffer + capacity),
+        backend_(StorageBackend::Inline),
+        gapBuffer_(false),
+        gapIndex_(0),
+        gapSize_(0)
     {
     }
 
@@ -70,6 +258,9 @@ namespace ds::mm {
     CompactMemoryManager<BlockType>::CompactMemoryManager(const CompactMemoryManager<BlockType>& other) :
         CompactMemoryManager(other.getAllocatedBlockCount())
     {
+        growthPolicy_ = other.growthPolicy_;
+        storagePolicy_ = other.storagePolicy_;
+        gapBuffer_ = other.gapBuffer_;
         this->assign(other);
     }
 
@@ -78,7 +269,7 @@ namespace ds::mm {
     {
         // Ensures that destructor of each object is called.
         CompactMemoryManager<BlockType>::releaseMemory(base_);
-        std::free(base_);
+        freeStorage(base_, this->getCapacity(), backend_);
 
         base_ = nullptr;
         end_ = nullptr;
@@ -88,15 +279,41 @@ namespace ds::mm {
     template<typename BlockType>
     BlockType* CompactMemoryManager<BlockType>::allocateMemory()
     {
-        return this->allocateMemoryAt(static_cast<size_t>(end_ - base_));
+        return this->allocateMemoryAt(this->getAllocatedBlockCount());
     }
 
     template<typename BlockType>
     BlockType* CompactMemoryManager<BlockType>::allocateMemoryAt(size_t index)
     {
-        if (end_ == limit_)
+        if (end_ == limit_ && gapSize_ == 0)
         {
-            this->changeCapacity(2 * this->getAllocatedBlockCount());
+            this->changeCapacity(growthPolicy_.nextCapacity(this->getCapacity()));
+        }
+
+        if (gapBuffer_ && (gapSize_ != 0 || index != this->getAllocatedBlockCount()))
+        {
+            if (gapSize_ == 0)
+            {
+                // Opens the gap from all the free capacity behind the blocks.
+                const size_t freeSize = static_cast<size_t>(limit_ - end_);
+                std::memmove(
+                    static_cast<void*>(base_ + index + freeSize),
+                    static_cast<const void*>(base_ + index),
+                    (this->getAllocatedBlockCount() - index) * sizeof(BlockType)
+                );
+                gapIndex_ = index;
+                gapSize_ = freeSize;
+                end_ = limit_;
+            }
+            else
+            {
+                this->moveGap(index);
+            }
+
+            this->countAllocations();
+            ++gapIndex_;
+            --gapSize_;
+            return placement_new(base_ + index);
         }
 
         if (end_ - base_ > static_cast<std::ptrdiff_t>(index))
@@ -108,7 +325,7 @@ namespace ds::mm {
             );
         }
 
-        ++MemoryManager<BlockType>::allocatedBlockCount_;
+        this->countAllocations();
         ++end_;
 
         return placement_new(base_ + index);
@@ -117,6 +334,16 @@ namespace ds::mm {
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
     {
+        if (gapSize_ != 0)
+        {
+            const size_t position = static_cast<size_t>(pointer - base_);
+            const size_t index = position <= gapIndex_
+                ? position
+                : position < gapIndex_ + gapSize_ ? gapIndex_ : position - gapSize_;
+            this->closeGap();
+            pointer = base_ + index;
+        }
+
         BlockType* p = pointer;
         while (p != end_)
         {
@@ -124,13 +351,22 @@ namespace ds::mm {
             ++p;
         }
 
+        this->countReleases(static_cast<size_t>(end_ - pointer));
         end_ = pointer;
-        MemoryManager<BlockType>::allocatedBlockCount_ = static_cast<size_t>(end_ - base_);
     }
 
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemoryAt(size_t index)
     {
+        if (gapBuffer_)
+        {
+            this->moveGap(index);
+            destroy(base_ + index + gapSize_);
+            ++gapSize_;
+            this->countReleases();
+            return;
+        }
+
         destroy(&this->getBlockAt(index));
         std::memmove(
             base_ + index,
@@ -138,13 +374,20 @@ namespace ds::mm {
             (end_ - base_ - index - 1) * sizeof(BlockType)
         );
         --end_;
-        --this->allocatedBlockCount_;
+        this->countReleases();
     }
 
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemory()
     {
-        this->releaseMemory(end_ - 1);
+        if (gapSize_ != 0)
+        {
+            this->releaseMemoryAt(this->getAllocatedBlockCount() - 1);
+        }
+        else
+        {
+            this->releaseMemory(end_ - 1);
+        }
     }
 
     template<typename BlockType>
@@ -153,6 +396,104 @@ namespace ds::mm {
         return limit_ - base_;
     }
 
+    template<typename BlockType>
+    size_t CompactMemoryManager<BlockType>::getAllocatedCapacitySize() const
+    {
+        return this->getCapacity() * sizeof(BlockType);
+    }
+
+    template<typename BlockType>
+    MemoryManager<BlockType>* CompactMemoryManager<BlockType>::createEmpty(size_t blockCount) const
+    {
+        CompactMemoryManager<BlockType>* result = new CompactMemoryManager<BlockType>(blockCount);
+        result->growthPolicy_ = growthPolicy_;
+        result->setStoragePolicy(storagePolicy_);
+        result->gapBuffer_ = gapBuffer_;
+        return result;
+    }
+
+    template<typename BlockType>
+    const GrowthPolicy& CompactMemoryManager<BlockType>::getGrowthPolicy() const
+    {
+        return growthPolicy_;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::setGrowthPolicy(const GrowthPolicy& growthPolicy)
+    {
+        growthPolicy_ = growthPolicy;
+    }
+
+    template<typename BlockType>
+    const StoragePolicy& CompactMemoryManager<BlockType>::getStoragePolicy() const
+    {
+        return storagePolicy_;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::setStoragePolicy(const StoragePolicy& storagePolicy)
+    {
+        if ((storagePolicy.alignment_ & (storagePolicy.alignment_ - 1)) != 0)
+        {
+            throw std::invalid_argument("Alignment must be a power of two!");
+        }
+
+        storagePolicy_ = storagePolicy;
+
+        if (reinterpret_cast<std::uintptr_t>(base_) % this->getAlignment() != 0)
+        {
+            const size_t capacity = this->getCapacity();
+            this->closeGap();
+            this->reallocateStorage(capacity);
+            end_ = base_ + this->getAllocatedBlockCount();
+            limit_ = base_ + capacity;
+        }
+    }
+
+    template<typename BlockType>
+    StorageBackend CompactMemoryManager<BlockType>::getStorageBackend() const
+    {
+        return backend_;
+    }
+
+    template<typename BlockType>
+    size_t CompactMemoryManager<BlockType>::getPageSize() const
+    {
+        return backend_ == StorageBackend::HugePages ? getHugePageSize() : getSystemPageSize();
+    }
+
+    template<typename BlockType>
+    size_t CompactMemoryManager<BlockType>::getAlignment() const
+    {
+        return (std::max)({ storagePolicy_.alignment_, alignof(BlockType), alignof(std::max_align_t) });
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::setGapBuffer(bool gapBuffer)
+    {
+        if (!gapBuffer)
+        {
+            this->closeGap();
+        }
+        gapBuffer_ = gapBuffer;
+    }
+
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::isGapBuffer() const
+    {
+        return gapBuffer_;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::makeContiguous()
+    {
+        const size_t count = this->getAllocatedBlockCount();
+        if (gapSize_ != 0 && gapIndex_ != 0 && gapIndex_ != count)
+        {
+            this->moveGap(gapIndex_ < count - gapIndex_ ? 0 : count);
+        }
+    }
+
     template<typename BlockType>
     CompactMemoryManager<BlockType>& CompactMemoryManager<BlockType>::assign
     (const CompactMemoryManager<BlockType>& other)
@@ -160,19 +501,18 @@ namespace ds::mm {
         if (this != &other)
         {
             this->releaseMemory(base_);
-            this->allocatedBlockCount_ = other.MemoryManager<BlockType>::allocatedBlockCount_;
-            void* newBase = std::realloc(base_, other.getAllocatedCapacitySize());
-            if (newBase == nullptr)
+            // An inline buffer is kept as long as the blocks fit into it.
+            if (backend_ != StorageBackend::Inline || other.getAllocatedBlockCount() > this->getCapacity())
             {
-                throw std::bad_alloc();
+                this->reallocateStorage(other.getCapacity());
+                limit_ = base_ + (other.limit_ - other.base_);
             }
-            base_ = static_cast<BlockType*>(newBase);
+            this->countAllocations(other.getAllocatedBlockCount());
             end_ = base_ + this->allocatedBlockCount_;
-            limit_ = base_ + (other.limit_ - other.base_);
 
             for (size_t i = 0; i < other.getAllocatedBlockCount(); ++i)
             {
-                placement_copy(base_ + i, *(other.base_ + i));
+                placement_copy(base_ + i, other.getBlockAt(i));
             }
         }
         return *this;
@@ -181,7 +521,7 @@ namespace ds::mm {
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::shrinkMemory()
     {
-        size_t newCapacity = static_cast<size_t>(end_ - base_);
+        size_t newCapacity = this->getAllocatedBlockCount();
 
         if (newCapacity < CompactMemoryManager<BlockType>::INIT_SIZE)
         {
@@ -199,19 +539,14 @@ namespace ds::mm {
             return;
         }
 
+        this->closeGap();
+
         if (newCapacity < this->getAllocatedBlockCount())
         {
             this->releaseMemory(base_ + newCapacity);
         }
 
-        void* newBase = std::realloc(base_, newCapacity * sizeof(BlockType));
-
-        if (newBase == nullptr)
-        {
-            throw std::bad_alloc();
-        }
-
-        base_ = static_cast<BlockType*>(newBase);
+        this->reallocateStorage(newCapacity);
         end_ = base_ + MemoryManager<BlockType>::allocatedBlockCount_;
         limit_ = base_ + newCapacity;
     }
@@ -225,34 +560,65 @@ namespace ds::mm {
     template<typename BlockType>
     bool CompactMemoryManager<BlockType>::equals(const CompactMemoryManager<BlockType>& other) const
     {
-        return this == &other ||
-            this->getAllocatedBlockCount() == other.getAllocatedBlockCount() &&
-            std::memcmp(base_, other.base_, this->getAllocatedBlocksSize()) == 0;
+        if (this == &other)
+        {
+            return true;
+        }
+
+        if (this->getAllocatedBlockCount() != other.getAllocatedBlockCount())
+        {
+            return false;
+        }
+
+        if (gapSize_ == 0 && other.gapSize_ == 0)
+        {
+            return std::memcmp(base_, other.base_, this->getAllocatedBlocksSize()) == 0;
+        }
+
+        for (size_t i = 0; i < this->getAllocatedBlockCount(); ++i)
+        {
+            if (std::memcmp(&this->getBlockAt(i), &other.getBlockAt(i), sizeof(BlockType)) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     template<typename BlockType>
     void* CompactMemoryManager<BlockType>::calculateAddress(const BlockType& data)
     {
-        BlockType* p = base_;
+        const size_t index = this->calculateIndex(data);
+        return index == INVALID_INDEX ? nullptr : &this->getBlockAt(index);
+    }
 
-        while (p != end_ && p != &data)
+    template<typename BlockType>
+    size_t CompactMemoryManager<BlockType>::calculateIndex(const BlockType& data)
+    {
+        if (&data >= end_ || &data < base_)
         {
-            ++p;
+            return INVALID_INDEX;
+        }
+
+        const size_t position = static_cast<size_t>(&data - base_);
+        if (position < gapIndex_ || gapSize_ == 0)
+        {
+            return position;
         }
 
-        return p == end_ ? nullptr : p;
+        return position < gapIndex_ + gapSize_ ? INVALID_INDEX : position - gapSize_;
     }
 
     template<typename BlockType>
-    size_t CompactMemoryManager<BlockType>::calculateIndex(const BlockType& data)
+    BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index)
     {
-        return &data < end_ && &data >= base_ ? &data - base_ : INVALID_INDEX;
+        return *(base_ + index + (index < gapIndex_ ? 0 : gapSize_));
     }
 
     template<typename BlockType>
-    BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index)
+    const BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index) const
     {
-        return *(base_ + index);
+        return *(base_ + index + (index < gapIndex_ ? 0 : gapSize_));
     }
 
     template<typename BlockType>
@@ -264,13 +630,241 @@ namespace ds::mm {
     template<typename BlockType>
     size_t CompactMemoryManager<BlockType>::getAllocatedBlocksSize() const
     {
-        return (end_ - base_) * sizeof(BlockType);
+        return this->getAllocatedBlockCount() * sizeof(BlockType);
     }
 
     template<typename BlockType>
-    size_t CompactMemoryManager<BlockType>::getAllocatedCapacitySize() const
+    bool CompactMemoryManager<BlockType>::shouldMap(size_t capacity) const
+    {
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+        return IsTriviallyRelocatable<BlockType>::value
+            && capacity * sizeof(BlockType) >= storagePolicy_.mapThreshold_
+            && this->getAlignment() <= getSystemPageSize();
+#else
+        static_cast<void>(capacity);
+        return false;
+#endif
+    }
+
+    template<typename BlockType>
+    BlockType* CompactMemoryManager<BlockType>::allocateStorage(size_t capacity, StorageBackend& backend) const
+    {
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+        if (this->shouldMap(capacity))
+        {
+            // Pages faulted in by MAP_POPULATE would be small ones, so prefer populating after the advice.
+#if defined(MADV_POPULATE_WRITE)
+            const bool populateAfterAdvice = storagePolicy_.populate_;
+#else
+            const bool populateAfterAdvice = false;
+#endif
+            // Anonymous mappings are zero-filled just like calloc.
+            const int flags = MAP_PRIVATE | MAP_ANONYMOUS | (storagePolicy_.populate_ && !populateAfterAdvice ? MAP_POPULATE : 0);
+            void* base = mmap(nullptr, capacity * sizeof(BlockType), PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (base == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            backend = StorageBackend::Mapped;
+            this->adviseStorage(static_cast<BlockType*>(base), capacity, backend);
+#if defined(MADV_POPULATE_WRITE)
+            if (populateAfterAdvice)
+            {
+                madvise(base, capacity * sizeof(BlockType), MADV_POPULATE_WRITE);
+            }
+#endif
+            return static_cast<BlockType*>(base);
+        }
+#endif
+
+        if (this->isOverAligned())
+        {
+            backend = StorageBackend::AlignedHeap;
+            if (capacity == 0)
+            {
+                return nullptr;
+            }
+
+            const size_t size = capacity * sizeof(BlockType);
+#if defined(_WIN32)
+            void* base = _aligned_malloc(size, this->getAlignment());
+#else
+            void* base = nullptr;
+            if (posix_memalign(&base, this->getAlignment(), size) != 0)
+            {
+                base = nullptr;
+            }
+#endif
+            if (base == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            std::memset(base, 0, size);
+            return static_cast<BlockType*>(base);
+        }
+
+        void* base = std::calloc(capacity, sizeof(BlockType));
+        if (base == nullptr && capacity != 0)
+        {
+            throw std::bad_alloc();
+        }
+        backend = StorageBackend::Heap;
+        return static_cast<BlockType*>(base);
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::adviseStorage(BlockType* base, size_t capacity, StorageBackend& backend) const
+    {
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+        const size_t size = capacity * sizeof(BlockType);
+        if (storagePolicy_.hugePages_ && getHugePageSize() != 0 && madvise(base, size, MADV_HUGEPAGE) == 0)
+        {
+            backend = StorageBackend::HugePages;
+        }
+        else
+        {
+            if (backend == StorageBackend::HugePages)
+            {
+                madvise(base, size, MADV_NOHUGEPAGE);
+            }
+            backend = StorageBackend::Mapped;
+        }
+#else
+        static_cast<void>(base);
+        static_cast<void>(capacity);
+        static_cast<void>(backend);
+#endif
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::reallocateStorage(size_t newCapacity)
     {
-        return (limit_ - base_) * sizeof(BlockType);
+        const size_t count = this->getAllocatedBlockCount();
+        const size_t capacity = this->getCapacity();
+
+        if constexpr (IsTriviallyRelocatable<BlockType>::value)
+        {
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+            if ((backend_ == StorageBackend::Mapped || backend_ == StorageBackend::HugePages) && this->shouldMap(newCapacity))
+            {
+                // Pages are moved by the kernel, the blocks are not copied.
+                void* newBase = mremap(base_, capacity * sizeof(BlockType), newCapacity * sizeof(BlockType), MREMAP_MAYMOVE);
+                if (newBase == MAP_FAILED)
+                {
+                    throw std::bad_alloc();
+                }
+                base_ = static_cast<BlockType*>(newBase);
+                this->adviseStorage(base_, newCapacity, backend_);
+#if defined(MADV_POPULATE_WRITE)
+                if (storagePolicy_.populate_ && newCapacity > capacity)
+                {
+                    madvise(base_, newCapacity * sizeof(BlockType), MADV_POPULATE_WRITE);
+                }
+#endif
+                return;
+            }
+#endif
+            if (backend_ == StorageBackend::Heap && !this->isOverAligned() && !this->shouldMap(newCapacity) && newCapacity != 0)
+            {
+                void* newBase = std::realloc(base_, newCapacity * sizeof(BlockType));
+                if (newBase == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                base_ = static_cast<BlockType*>(newBase);
+                return;
+            }
+        }
+
+        StorageBackend newBackend = backend_;
+        BlockType* newBase = this->allocateStorage(newCapacity, newBackend);
+        if constexpr (IsTriviallyRelocatable<BlockType>::value)
+        {
+            if (count != 0)
+            {
+                std::memcpy(static_cast<void*>(newBase), static_cast<const void*>(base_), count * sizeof(BlockType));
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                placement_move(newBase + i, base_[i]);
+                destroy(base_ + i);
+            }
+        }
+        freeStorage(base_, capacity, backend_);
+        base_ = newBase;
+        backend_ = newBackend;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::freeStorage(BlockType* base, size_t capacity, StorageBackend backend)
+    {
+        if (backend == StorageBackend::Inline)
+        {
+            return;
+        }
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+        if (backend == StorageBackend::Mapped || backend == StorageBackend::HugePages)
+        {
+            munmap(base, capacity * sizeof(BlockType));
+            return;
+        }
+#else
+        static_cast<void>(capacity);
+#endif
+#if defined(_WIN32)
+        if (backend == StorageBackend::AlignedHeap)
+        {
+            _aligned_free(base);
+            return;
+        }
+#else
+        static_cast<void>(backend);
+#endif
+        std::free(base);
+    }
+
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::isOverAligned() const
+    {
+        return this->getAlignment() > alignof(std::max_align_t);
+    }
+
+    template<typename BlockType>
+    size_t CompactMemoryManager<BlockType>::getSystemPageSize()
+    {
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+        static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return pageSize;
+#else
+        return 4096;
+#endif
+    }
+
+    template<typename BlockType>
+    size_t CompactMemoryManager<BlockType>::getHugePageSize()
+    {
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+        // Zero when transparent huge pages are not available or disabled.
+        static const size_t pageSize = []()
+            {
+                std::string modes;
+                std::getline(std::ifstream("/sys/kernel/mm/transparent_hugepage/enabled"), modes);
+                if (modes.empty() || modes.find("[never]") != std::string::npos)
+                {
+                    return size_t{ 0 };
+                }
+
+                size_t size = 0;
+                std::ifstream("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size") >> size;
+                return size;
+            }();
+        return pageSize;
+#else
+        return 0;
+#endif
     }
 
     template<typename BlockType>
@@ -300,4 +894,40 @@ namespace ds::mm {
         os << limit_ << "|<- limit" << std::endl;
     }
 
-}
\ No newline at end of file
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::moveGap(size_t index)
+    {
+        if (gapSize_ != 0 && index < gapIndex_)
+        {
+            // Blocks [index, gapIndex_) move behind the gap.
+            std::memmove(
+                static_cast<void*>(base_ + index + gapSize_),
+                static_cast<const void*>(base_ + index),
+                (gapIndex_ - index) * sizeof(BlockType)
+            );
+        }
+        else if (gapSize_ != 0 && index > gapIndex_)
+        {
+            // Blocks [gapIndex_, index) move in front of the gap.
+            std::memmove(
+                static_cast<void*>(base_ + gapIndex_),
+                static_cast<const void*>(base_ + gapIndex_ + gapSize_),
+                (index - gapIndex_) * sizeof(BlockType)
+            );
+        }
+        gapIndex_ = index;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::closeGap()
+    {
+        if (gapSize_ != 0)
+        {
+            this->moveGap(this->getAllocatedBlockCount());
+            end_ -= gapSize_;
+            gapSize_ = 0;
+        }
+        gapIndex_ = 0;
+    }
+}
@@ -1,9 +1,15 @@
 #pragma once
 
 #include <libds/heap_monitor.h>
+#include <libds/mm/memory_statistics.h>
+#include <cstddef>
+#include <stdexcept>
 
 namespace ds::mm {
 
+	template<typename BlockType>
+	class PoolMemoryManager;
+
 	template<typename BlockType>
 	class MemoryManager {
 
@@ -16,15 +22,55 @@ namespace ds::mm {
 
 		void releaseAndSetNull(BlockType*& pointer);
 
+		/**
+		 * @brief Tells whether releaseAllMemory is supported. Structures owning such a manager
+		 *        release all their blocks by one call instead of walking them.
+		 */
+		virtual bool releasesInBulk() const;
+
+		/**
+		 * @brief Releases all blocks at once, only managers that release in bulk support it.
+		 */
+		virtual void releaseAllMemory();
+
 		size_t getAllocatedBlockCount() const;
 
+		/**
+		 * @brief Returns the number of bytes allocated or reserved for blocks by the manager.
+		 */
+		virtual size_t getAllocatedCapacitySize() const;
+
+		/**
+		 * @brief Returns a new empty manager of the same kind, sized for @p blockCount blocks if the kind allows it.
+		 *        This manager allocates each block separately, so it returns a pool of @p blockCount blocks
+		 *        instead, unless the blocks are over-aligned for the pool.
+		 */
+		virtual MemoryManager<BlockType>* createEmpty(size_t blockCount) const;
+
+		MemoryStatistics getStatistics() const;
+
+	protected:
+		/**
+		 * @brief Accounts @p count allocated blocks, managers must use it instead of changing the count directly.
+		 */
+		void countAllocations(size_t count = 1);
+		void countReleases(size_t count = 1);
+
 	protected:
 		size_t allocatedBlockCount_;
+
+	private:
+		size_t peakBlockCount_;
+		size_t allocationCount_;
+		size_t releaseCount_;
 	};
 
 	template<typename BlockType>
     MemoryManager<BlockType>::MemoryManager():
-		allocatedBlockCount_(0)
+		allocatedBlockCount_(0),
+		peakBlockCount_(0),
+		allocationCount_(0),
+		releaseCount_(0)
 	{
 	}
 
@@ -37,14 +83,14 @@ namespace ds::mm {
 	template<typename BlockType>
     BlockType* MemoryManager<BlockType>::allocateMemory()
 	{
-		allocatedBlockCount_++;
+		this->countAllocations();
 		return new BlockType();
 	}
 
 	template<typename BlockType>
     void MemoryManager<BlockType>::releaseMemory(BlockType* pointer)
 	{
-		allocatedBlockCount_--;
+		this->countReleases();
 		delete pointer;
 	}
 
@@ -55,9 +101,74 @@ namespace ds::mm {
 		pointer = nullptr;
 	}
 
+	template<typename BlockType>
+    bool MemoryManager<BlockType>::releasesInBulk() const
+	{
+		return false;
+	}
+
+	template<typename BlockType>
+    void MemoryManager<BlockType>::releaseAllMemory()
+	{
+		throw std::logic_error("Memory manager does not release in bulk!");
+	}
+
 	template<typename BlockType>
     size_t MemoryManager<BlockType>::getAllocatedBlockCount() const
 	{
 		return allocatedBlockCount_;
 	}
-}
\ No newline at end of file
+
+	template<typename BlockType>
+    size_t MemoryManager<BlockType>::getAllocatedCapacitySize() const
+	{
+		return allocatedBlockCount_ * sizeof(BlockType);
+	}
+
+	template<typename BlockType>
+    MemoryManager<BlockType>* MemoryManager<BlockType>::createEmpty(size_t blockCount) const
+	{
+		if constexpr (alignof(BlockType) <= alignof(std::max_align_t))
+		{
+			return new PoolMemoryManager<BlockType>(blockCount);
+		}
+		else
+		{
+			static_cast<void>(blockCount);
+			return new MemoryManager<BlockType>();
+		}
+	}
+
+	template<typename BlockType>
+    MemoryStatistics MemoryManager<BlockType>::getStatistics() const
+	{
+		MemoryStatistics statistics;
+		statistics.blockSize_ = sizeof(BlockType);
+		statistics.liveBlockCount_ = allocatedBlockCount_;
+		statistics.peakBlockCount_ = peakBlockCount_;
+		statistics.allocationCount_ = allocationCount_;
+		statistics.releaseCount_ = releaseCount_;
+		statistics.capacitySize_ = this->getAllocatedCapacitySize();
+		return statistics;
+	}
+
+	template<typename BlockType>
+    void MemoryManager<BlockType>::countAllocations(size_t count)
+	{
+		allocatedBlockCount_ += count;
+		allocationCount_ += count;
+		if (allocatedBlockCount_ > peakBlockCount_)
+		{
+			peakBlockCount_ = allocatedBlockCount_;
+		}
+	}
+
+	template<typename BlockType>
+    void MemoryManager<BlockType>::countReleases(size_t count)
+	{
+		allocatedBlockCount_ -= count;
+		releaseCount_ += count;
+	}
+}
+
+#include <libds/mm/pool_memory_manager.h>
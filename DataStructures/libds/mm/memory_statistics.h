@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ds::mm {
+
+    /**
+     * @brief Snapshot of the allocation accounting of one memory manager.
+     *
+     * Sizes are in bytes. The capacity covers blocks that are allocated or reserved by the manager,
+     * the waste is the part of it not used by live blocks.
+     */
+    struct MemoryStatistics
+    {
+        size_t blockSize_ = 0;
+        size_t liveBlockCount_ = 0;
+        size_t peakBlockCount_ = 0;
+        size_t allocationCount_ = 0;
+        size_t releaseCount_ = 0;
+        size_t capacitySize_ = 0;
+
+        size_t getLiveSize() const;
+        size_t getPeakSize() const;
+        size_t getWasteSize() const;
+
+        /**
+         * @brief Writes the statistics as a single JSON object.
+         */
+        void writeJson(std::ostream& os) const;
+    };
+
+    /**
+     * @brief Named statistics of several structures, written as one JSON object keyed by the names.
+     */
+    class MemoryReport
+    {
+    public:
+        void add(std::string name, const MemoryStatistics& statistics);
+
+        void writeJson(std::ostream& os) const;
+
+    private:
+        std::vector<std::pair<std::string, MemoryStatistics>> entries_;
+    };
+
+    //----------
+
+    inline size_t MemoryStatistics::getLiveSize() const
+    {
+        return liveBlockCount_ * blockSize_;
+    }
+
+    inline size_t MemoryStatistics::getPeakSize() const
+    {
+        return peakBlockCount_ * blockSize_;
+    }
+
+    inline size_t MemoryStatistics::getWasteSize() const
+    {
+        return capacitySize_ > this->getLiveSize() ? capacitySize_ - this->getLiveSize() : 0;
+    }
+
+    inline void MemoryStatistics::writeJson(std::ostream& os) const
+    {
+        os << "{\"blockSize\":" << blockSize_
+            << ",\"liveBlocks\":" << liveBlockCount_
+            << ",\"liveBytes\":" << this->getLiveSize()
+            << ",\"peakBlocks\":" << peakBlockCount_
+            << ",\"peakBytes\":" << this->getPeakSize()
+            << ",\"allocations\":" << allocationCount_
+            << ",\"releases\":" << releaseCount_
+            << ",\"capacityBytes\":" << capacitySize_
+            << ",\"wasteBytes\":" << this->getWasteSize()
+            << "}";
+    }
+
+    //----------
+
+    inline void MemoryReport::add(std::string name, const MemoryStatistics& statistics)
+    {
+        entries_.emplace_back(std::move(name), statistics);
+    }
+
+    inline void MemoryReport::writeJson(std::ostream& os) const
+    {
+        os << "{";
+        for (size_t i = 0; i < entries_.size(); ++i)
+        {
+            os << (i == 0 ? "" : ",") << "\"";
+            for (const char c : entries_[i].first)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\';
+                }
+                os << c;
+            }
+            os << "\":";
+            entries_[i].second.writeJson(os);
+        }
+        os << "}";
+    }
+}
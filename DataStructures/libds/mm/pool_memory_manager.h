@@ -0,0 +1,170 @@
+#pragma once
+
+#include <libds/mm/memory_manager.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace ds::mm {
+
+    /**
+     * @brief Memory manager carving fixed-size blocks out of large slabs.
+     *
+     * Slabs double in size from the initial slab size up to MAX_SLAB_SIZE blocks. Released blocks
+     * are kept in an intrusive free list threaded through their own storage and are reused first,
+     * otherwise blocks are taken from the last slab in address order. Slabs are returned to the
+     * system only when the manager is destroyed, blocks still allocated then are not destroyed.
+     */
+    template<typename BlockType>
+    class PoolMemoryManager : public MemoryManager<BlockType> {
+        static_assert(alignof(BlockType) <= alignof(std::max_align_t), "Slabs are only aligned for fundamental types.");
+
+    public:
+        PoolMemoryManager();
+        explicit PoolMemoryManager(size_t slabSize);
+        PoolMemoryManager(const PoolMemoryManager<BlockType>& other) = delete;
+        PoolMemoryManager<BlockType>& operator=(const PoolMemoryManager<BlockType>& other) = delete;
+        ~PoolMemoryManager() override;
+
+        BlockType* allocateMemory() override;
+        void releaseMemory(BlockType* pointer) override;
+
+        /**
+         * @brief Returns the number of blocks that fit into all slabs.
+         */
+        size_t getCapacity() const;
+        size_t getSlabCount() const;
+        size_t getAllocatedCapacitySize() const override;
+
+        /**
+         * @brief Returns a new pool whose first slab holds @p blockCount blocks.
+         */
+        MemoryManager<BlockType>* createEmpty(size_t blockCount) const override;
+
+    private:
+        union Slot
+        {
+            Slot* next_;
+            alignas(BlockType) unsigned char block_[sizeof(BlockType)];
+        };
+
+        void addSlab();
+
+    private:
+        std::vector<Slot*> slabs_;
+        Slot* free_;
+        Slot* end_;
+        Slot* limit_;
+        size_t nextSlabSize_;
+        size_t capacity_;
+
+        static const size_t INIT_SLAB_SIZE = 64;
+        static const size_t MAX_SLAB_SIZE = 4096;
+    };
+
+    template<typename BlockType>
+    PoolMemoryManager<BlockType>::PoolMemoryManager() :
+        PoolMemoryManager(INIT_SLAB_SIZE)
+    {
+    }
+
+    template<typename BlockType>
+    PoolMemoryManager<BlockType>::PoolMemoryManager(size_t slabSize) :
+        free_(nullptr),
+        end_(nullptr),
+        limit_(nullptr),
+        nextSlabSize_(std::max<size_t>(slabSize, 1)),
+        capacity_(0)
+    {
+    }
+
+    template<typename BlockType>
+    PoolMemoryManager<BlockType>::~PoolMemoryManager()
+    {
+        for (Slot* slab : slabs_)
+        {
+            std::free(slab);
+        }
+        slabs_.clear();
+
+        free_ = nullptr;
+        end_ = nullptr;
+        limit_ = nullptr;
+    }
+
+    template<typename BlockType>
+    BlockType* PoolMemoryManager<BlockType>::allocateMemory()
+    {
+        Slot* slot = free_;
+        if (slot != nullptr)
+        {
+            free_ = slot->next_;
+        }
+        else
+        {
+            if (end_ == limit_)
+            {
+                this->addSlab();
+            }
+            slot = end_++;
+        }
+
+        this->countAllocations();
+        return placement_new(reinterpret_cast<BlockType*>(slot->block_));
+    }
+
+    template<typename BlockType>
+    void PoolMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
+    {
+        destroy(pointer);
+
+        Slot* slot = reinterpret_cast<Slot*>(pointer);
+        slot->next_ = free_;
+        free_ = slot;
+        this->countReleases();
+    }
+
+    template<typename BlockType>
+    size_t PoolMemoryManager<BlockType>::getCapacity() const
+    {
+        return capacity_;
+    }
+
+    template<typename BlockType>
+    size_t PoolMemoryManager<BlockType>::getSlabCount() const
+    {
+        return slabs_.size();
+    }
+
+    template<typename BlockType>
+    size_t PoolMemoryManager<BlockType>::getAllocatedCapacitySize() const
+    {
+        return capacity_ * sizeof(Slot);
+    }
+
+    template<typename BlockType>
+    MemoryManager<BlockType>* PoolMemoryManager<BlockType>::createEmpty(size_t blockCount) const
+    {
+        return new PoolMemoryManager<BlockType>(blockCount);
+    }
+
+    template<typename BlockType>
+    void PoolMemoryManager<BlockType>::addSlab()
+    {
+        const size_t slabSize = nextSlabSize_;
+        slabs_.reserve(slabs_.size() + 1);
+        Slot* slab = static_cast<Slot*>(std::malloc(slabSize * sizeof(Slot)));
+        if (slab == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        slabs_.push_back(slab);
+        end_ = slab;
+        limit_ = slab + slabSize;
+        capacity_ += slabSize;
+        nextSlabSize_ = std::max(slabSize, std::min(2 * slabSize, static_cast<size_t>(MAX_SLAB_SIZE)));
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <libds/mm/compact_memory_manager.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace ds::mm {
+
+    /**
+     * @brief Buffer for InlineCapacity blocks, a base of SmallCompactMemoryManager so that it is
+     *        constructed before and destroyed after the blocks stored in it.
+     */
+    template<typename BlockType, size_t InlineCapacity>
+    struct InlineBlockBuffer
+    {
+        alignas((std::max)(alignof(BlockType), alignof(std::max_align_t)))
+        unsigned char buffer_[InlineCapacity * sizeof(BlockType)];
+    };
+
+    /**
+     * @brief Compact memory manager storing up to InlineCapacity blocks in itself.
+     *
+     * The blocks move to a heap buffer, which is kept from then on, when the manager grows beyond
+     * the inline buffer or when its storage policy asks for a larger alignment.
+     */
+    template<typename BlockType, size_t InlineCapacity>
+    class SmallCompactMemoryManager :
+        private InlineBlockBuffer<BlockType, InlineCapacity>,
+        public CompactMemoryManager<BlockType>
+    {
+        static_assert(InlineCapacity > 0, "Inline buffer must hold at least one block.");
+
+    public:
+        SmallCompactMemoryManager();
+        SmallCompactMemoryManager(const SmallCompactMemoryManager<BlockType, InlineCapacity>& other) = delete;
+        SmallCompactMemoryManager<BlockType, InlineCapacity>& operator=(const SmallCompactMemoryManager<BlockType, InlineCapacity>& other) = delete;
+
+        /**
+         * @brief Tells whether the blocks are still stored in the inline buffer.
+         */
+        bool isInline() const;
+
+        /**
+         * @brief Returns a new manager with an empty inline buffer and the same policies.
+         */
+        MemoryManager<BlockType>* createEmpty(size_t blockCount) const override;
+    };
+
+    //----------
+
+    template<typename BlockType, size_t InlineCapacity>
+    SmallCompactMemoryManager<BlockType, InlineCapacity>::SmallCompactMemoryManager() :
+        InlineBlockBuffer<BlockType, InlineCapacity>(),
+        CompactMemoryManager<BlockType>(reinterpret_cast<BlockType*>(this->buffer_), InlineCapacity)
+    {
+    }
+
+    template<typename BlockType, size_t InlineCapacity>
+    bool SmallCompactMemoryManager<BlockType, InlineCapacity>::isInline() const
+    {
+        return this->getStorageBackend() == StorageBackend::Inline;
+    }
+
+    template<typename BlockType, size_t InlineCapacity>
+    MemoryManager<BlockType>* SmallCompactMemoryManager<BlockType, InlineCapacity>::createEmpty(size_t blockCount) const
+    {
+        SmallCompactMemoryManager<BlockType, InlineCapacity>* result = new SmallCompactMemoryManager<BlockType, InlineCapacity>();
+        result->setGrowthPolicy(this->getGrowthPolicy());
+        result->setStoragePolicy(this->getStoragePolicy());
+        result->setGapBuffer(this->isGapBuffer());
+        if (blockCount > InlineCapacity)
+        {
+            result->changeCapacity(blockCount);
+        }
+        return result;
+    }
+}
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <libds/mm/memory_manager.h>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace ds::mm {
+
+    /**
+     * @brief Memory manager keeping released blocks in a per-thread cache in front of a shared pool.
+     *
+     * All managers of the same block type share one central pool of slabs. Every thread takes
+     * blocks from its own free list without locking and refills it from the central pool one
+     * batch of BATCH_SIZE blocks at a time. A block may be released by another thread than the
+     * one that allocated it, it then goes to the cache of the releasing thread. A cache holding
+     * 2 * BATCH_SIZE blocks returns one batch to the central pool, a cache of an exiting thread
+     * returns all its blocks. Slabs are returned to the system only at program exit.
+     *
+     * A single manager, like any other, must not be used by several threads at once.
+     */
+    template<typename BlockType>
+    class ThreadCachingMemoryManager : public MemoryManager<BlockType> {
+        static_assert(alignof(BlockType) <= alignof(std::max_align_t), "Slabs are only aligned for fundamental types.");
+
+    public:
+        ThreadCachingMemoryManager() = default;
+        ThreadCachingMemoryManager(const ThreadCachingMemoryManager<BlockType>& other) = delete;
+        ThreadCachingMemoryManager<BlockType>& operator=(const ThreadCachingMemoryManager<BlockType>& other) = delete;
+
+        BlockType* allocateMemory() override;
+        void releaseMemory(BlockType* pointer) override;
+        MemoryManager<BlockType>* createEmpty(size_t blockCount) const override;
+
+        /**
+         * @brief Returns the number of free blocks cached by the calling thread.
+         */
+        static size_t getThreadCacheSize();
+
+        /**
+         * @brief Returns the number of free blocks returned to the central pool.
+         */
+        static size_t getCentralCacheSize();
+
+        static const size_t BATCH_SIZE = 32;
+
+    private:
+        union Slot
+        {
+            Slot* next_;
+            alignas(BlockType) unsigned char block_[sizeof(BlockType)];
+        };
+
+        struct Batch
+        {
+            Slot* head_;
+            size_t size_;
+        };
+
+        class CentralPool
+        {
+        public:
+            CentralPool();
+            CentralPool(const CentralPool& other) = delete;
+            CentralPool& operator=(const CentralPool& other) = delete;
+            ~CentralPool();
+
+            Batch fetch();
+            void release(Batch batch);
+            size_t getFreeCount();
+
+        private:
+            std::mutex mutex_;
+            std::vector<Slot*> slabs_;
+            std::vector<Batch> batches_;
+            Slot* end_;
+            Slot* limit_;
+            size_t freeCount_;
+
+            static const size_t SLAB_SIZE = 64 * BATCH_SIZE;
+        };
+
+        class ThreadCache
+        {
+        public:
+            ThreadCache();
+            ThreadCache(const ThreadCache& other) = delete;
+            ThreadCache& operator=(const ThreadCache& other) = delete;
+            ~ThreadCache();
+
+            Slot* pop();
+            void push(Slot* slot);
+            size_t size() const;
+
+        private:
+            Slot* free_;
+            size_t size_;
+        };
+
+        static CentralPool& centralPool();
+        static ThreadCache& threadCache();
+    };
+
+    template<typename BlockType>
+    BlockType* ThreadCachingMemoryManager<BlockType>::allocateMemory()
+    {
+        Slot* slot = threadCache().pop();
+        this->countAllocations();
+        return placement_new(reinterpret_cast<BlockType*>(slot->block_));
+    }
+
+    template<typename BlockType>
+    void ThreadCachingMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
+    {
+        destroy(pointer);
+        threadCache().push(reinterpret_cast<Slot*>(pointer));
+        this->countReleases();
+    }
+
+    template<typename BlockType>
+    MemoryManager<BlockType>* ThreadCachingMemoryManager<BlockType>::createEmpty(size_t blockCount) const
+    {
+        static_cast<void>(blockCount);
+        return new ThreadCachingMemoryManager<BlockType>();
+    }
+
+    template<typename BlockType>
+    size_t ThreadCachingMemoryManager<BlockType>::getThreadCacheSize()
+    {
+        return threadCache().size();
+    }
+
+    template<typename BlockType>
+    size_t ThreadCachingMemoryManager<BlockType>::getCentralCacheSize()
+    {
+        return centralPool().getFreeCount();
+    }
+
+    template<typename BlockType>
+    typename ThreadCachingMemoryManager<BlockType>::CentralPool& ThreadCachingMemoryManager<BlockType>::centralPool()
+    {
+        static CentralPool pool;
+        return pool;
+    }
+
+    template<typename BlockType>
+    typename ThreadCachingMemoryManager<BlockType>::ThreadCache& ThreadCachingMemoryManager<BlockType>::threadCache()
+    {
+        // Thread caches are destroyed before objects with static storage duration,
+        // so the central pool is still alive when the cache of the main thread is returned.
+        centralPool();
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    //----------
+
+    template<typename BlockType>
+    ThreadCachingMemoryManager<BlockType>::CentralPool::CentralPool() :
+        end_(nullptr),
+        limit_(nullptr),
+        freeCount_(0)
+    {
+    }
+
+    template<typename BlockType>
+    ThreadCachingMemoryManager<BlockType>::CentralPool::~CentralPool()
+    {
+        for (Slot* slab : slabs_)
+        {
+            std::free(slab);
+        }
+    }
+
+    template<typename BlockType>
+    typename ThreadCachingMemoryManager<BlockType>::Batch ThreadCachingMemoryManager<BlockType>::CentralPool::fetch()
+    {
+        Slot* fresh;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!batches_.empty())
+            {
+                const Batch batch = batches_.back();
+                batches_.pop_back();
+                freeCount_ -= batch.size_;
+                return batch;
+            }
+
+            if (end_ == limit_)
+            {
+                slabs_.reserve(slabs_.size() + 1);
+                Slot* slab = static_cast<Slot*>(std::malloc(SLAB_SIZE * sizeof(Slot)));
+                if (slab == nullptr)
+                {
+                    throw std::bad_alloc();
+                }
+                slabs_.push_back(slab);
+                end_ = slab;
+                limit_ = slab + SLAB_SIZE;
+            }
+
+            fresh = end_;
+            end_ += BATCH_SIZE;
+        }
+
+        // Fresh slots are owned by the calling thread only, they are linked outside of the lock.
+        for (size_t i = 0; i < BATCH_SIZE - 1; ++i)
+        {
+            fresh[i].next_ = &fresh[i + 1];
+        }
+        fresh[BATCH_SIZE - 1].next_ = nullptr;
+        return { fresh, BATCH_SIZE };
+    }
+
+    template<typename BlockType>
+    void ThreadCachingMemoryManager<BlockType>::CentralPool::release(Batch batch)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batches_.push_back(batch);
+        freeCount_ += batch.size_;
+    }
+
+    template<typename BlockType>
+    size_t ThreadCachingMemoryManager<BlockType>::CentralPool::getFreeCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return freeCount_;
+    }
+
+    //----------
+
+    template<typename BlockType>
+    ThreadCachingMemoryManager<BlockType>::ThreadCache::ThreadCache() :
+        free_(nullptr),
+        size_(0)
+    {
+    }
+
+    template<typename BlockType>
+    ThreadCachingMemoryManager<BlockType>::ThreadCache::~ThreadCache()
+    {
+        if (free_ != nullptr)
+        {
+            centralPool().release({ free_, size_ });
+        }
+        free_ = nullptr;
+        size_ = 0;
+    }
+
+    template<typename BlockType>
+    typename ThreadCachingMemoryManager<BlockType>::Slot* ThreadCachingMemoryManager<BlockType>::ThreadCache::pop()
+    {
+        if (free_ == nullptr)
+        {
+            const Batch batch = centralPool().fetch();
+            free_ = batch.head_;
+            size_ = batch.size_;
+        }
+
+        Slot* slot = free_;
+        free_ = slot->next_;
+        --size_;
+        return slot;
+    }
+
+    template<typename BlockType>
+    void ThreadCachingMemoryManager<BlockType>::ThreadCache::push(Slot* slot)
+    {
+        slot->next_ = free_;
+        free_ = slot;
+        ++size_;
+
+        if (size_ >= 2 * BATCH_SIZE)
+        {
+            Slot* last = free_;
+            for (size_t i = 1; i < BATCH_SIZE; ++i)
+            {
+                last = last->next_;
+            }
+
+            Slot* const head = free_;
+            free_ = last->next_;
+            last->next_ = nullptr;
+            size_ -= BATCH_SIZE;
+            centralPool().release({ head, BATCH_SIZE });
+        }
+    }
+
+    template<typename BlockType>
+    size_t ThreadCachingMemoryManager<BlockType>::ThreadCache::size() const
+    {
+        return size_;
+    }
+}
@@ -2,6 +2,9 @@
 
 #include <tests/_details/test.hpp>
 #include <tests/adt/array.test.h>
+#include <tests/adt/concurrent_queue.test.h>
+#include <tests/adt/concurrent_stack.test.h>
+#include <tests/adt/external_sort.test.h>
 #include <tests/adt/list.test.h>
 #include <tests/adt/priority_queue.test.h>
 #include <tests/adt/queue.test.h>
@@ -22,10 +25,13 @@ namespace ds::tests
             this->add_test(std::make_unique<ListTest>());
             this->add_test(std::make_unique<PriorityQueueTest>());
             this->add_test(std::make_unique<QueueTest>());
+            this->add_test(std::make_unique<ConcurrentQueueTest>());
             this->add_test(std::make_unique<StackTest>());
+            this->add_test(std::make_unique<ConcurrentStackTest>());
             this->add_test(std::make_unique<TableTest>());
             this->add_test(std::make_unique<TreeTest>());
             this->add_test(std::make_unique<SortTest>());
+            this->add_test(std::make_unique<ExternalSortTest>());
         }
     };
 }
\ No newline at end of file
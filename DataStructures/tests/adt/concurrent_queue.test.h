@@ -0,0 +1,229 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/adt/concurrent_queue.h>
+#include <thread>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests single-threaded push, pop, and capacity of the SPSC queue.
+     */
+    class SpscQueueTestPushPop : public LeafTest
+    {
+    public:
+        SpscQueueTestPushPop() :
+            LeafTest("push-pop")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::SpscQueue<int> queue(5);
+            this->assert_equals(static_cast<size_t>(8), queue.getCapacity());
+
+            int output = -1;
+            this->assert_false(queue.tryPop(output), "Empty queue can't pop.");
+
+            for (int i = 0; i < 8; ++i)
+            {
+                this->assert_true(queue.tryPush(i), "Push to non-full queue.");
+            }
+            this->assert_false(queue.tryPush(8), "Full queue can't push.");
+            this->assert_equals(static_cast<size_t>(8), queue.size());
+
+            for (int i = 0; i < 8; ++i)
+            {
+                this->assert_true(queue.tryPop(output), "Pop from non-empty queue.");
+                this->assert_equals(i, output);
+            }
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests batch operations that wrap around the end of the ring.
+     */
+    class SpscQueueTestBatch : public LeafTest
+    {
+    public:
+        SpscQueueTestBatch() :
+            LeafTest("batch")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::SpscQueue<int> queue(8);
+            int input[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+            int output[12] = {};
+
+            this->assert_equals(static_cast<size_t>(6), queue.pushBatch(input, 6));
+            this->assert_equals(static_cast<size_t>(5), queue.popBatch(output, 5));
+            this->assert_equals(static_cast<size_t>(6), queue.pushBatch(input + 6, 6));
+            this->assert_equals(static_cast<size_t>(1), queue.pushBatch(input, 2));
+            this->assert_equals(static_cast<size_t>(7), queue.popBatch(output + 5, 7));
+
+            bool inOrder = true;
+            for (int i = 0; i < 12; ++i)
+            {
+                inOrder = inOrder && output[i] == i;
+            }
+            this->assert_true(inOrder, "Batches preserve FIFO order.");
+        }
+    };
+
+    /**
+     * @brief Tests transfer of elements between a producer and a consumer thread.
+     */
+    class SpscQueueTestTwoThreads : public LeafTest
+    {
+    public:
+        SpscQueueTestTwoThreads() :
+            LeafTest("two-threads")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 100'000;
+            adt::SpscQueue<int> queue(64);
+
+            std::thread producer([&queue]()
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        queue.push(i);
+                    }
+                });
+
+            bool inOrder = true;
+            for (int i = 0; i < n; ++i)
+            {
+                inOrder = inOrder && queue.pop() == i;
+            }
+            producer.join();
+
+            this->assert_true(inOrder, "Consumer received all elements in order.");
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests single-threaded push, pop, and capacity of the MPMC queue.
+     */
+    class MpmcQueueTestPushPop : public LeafTest
+    {
+    public:
+        MpmcQueueTestPushPop() :
+            LeafTest("push-pop")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::MpmcQueue<int> queue(4);
+            this->assert_equals(static_cast<size_t>(4), queue.getCapacity());
+
+            int output = -1;
+            this->assert_false(queue.tryPop(output), "Empty queue can't pop.");
+
+            for (int round = 0; round < 3; ++round)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    this->assert_true(queue.tryPush(i), "Push to non-full queue.");
+                }
+                this->assert_false(queue.tryPush(4), "Full queue can't push.");
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    this->assert_equals(i, queue.pop());
+                }
+                this->assert_true(queue.isEmpty(), "Queue is empty.");
+            }
+        }
+    };
+
+    /**
+     * @brief Tests that several producers and consumers transfer every element exactly once.
+     */
+    class MpmcQueueTestManyThreads : public LeafTest
+    {
+    public:
+        MpmcQueueTestManyThreads() :
+            LeafTest("many-threads")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int threadCount = 4;
+            constexpr int perThread = 25'000;
+            adt::MpmcQueue<int> queue(64);
+            std::vector<long long> sums(threadCount, 0);
+            std::vector<std::thread> threads;
+
+            for (int t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&queue, t]()
+                    {
+                        for (int i = 0; i < perThread; ++i)
+                        {
+                            queue.push(t * perThread + i);
+                        }
+                    });
+                threads.emplace_back([&queue, &sums, t]()
+                    {
+                        for (int i = 0; i < perThread; ++i)
+                        {
+                            sums[t] += queue.pop();
+                        }
+                    });
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            long long sum = 0;
+            for (long long partialSum : sums)
+            {
+                sum += partialSum;
+            }
+
+            constexpr long long n = static_cast<long long>(threadCount) * perThread;
+            this->assert_equals(n * (n - 1) / 2, sum);
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief All concurrent queue tests.
+     */
+    class ConcurrentQueueTest : public CompositeTest
+    {
+    public:
+        ConcurrentQueueTest() :
+            CompositeTest("ConcurrentQueue")
+        {
+            auto spsc = std::make_unique<CompositeTest>("SpscQueue");
+            spsc->add_test(std::make_unique<SpscQueueTestPushPop>());
+            spsc->add_test(std::make_unique<SpscQueueTestBatch>());
+            spsc->add_test(std::make_unique<SpscQueueTestTwoThreads>());
+            this->add_test(std::move(spsc));
+
+            auto mpmc = std::make_unique<CompositeTest>("MpmcQueue");
+            mpmc->add_test(std::make_unique<MpmcQueueTestPushPop>());
+            mpmc->add_test(std::make_unique<MpmcQueueTestManyThreads>());
+            this->add_test(std::move(mpmc));
+        }
+    };
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/adt/concurrent_stack.h>
+#include <thread>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests single-threaded push and pop of the concurrent stack.
+     */
+    class ConcurrentStackTestPushPop : public LeafTest
+    {
+    public:
+        ConcurrentStackTestPushPop() :
+            LeafTest("push-pop")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+            adt::ConcurrentStack<int> stack;
+
+            this->assert_throws([&stack]()
+                {
+                    stack.pop();
+                },
+                "Empty stack throws on pop"
+            );
+
+            for (int round = 0; round < 2; ++round)
+            {
+                for (int i = 0; i < n; ++i)
+                {
+                    stack.push(i);
+                }
+                this->assert_equals(static_cast<size_t>(n), stack.size());
+
+                for (int i = n - 1; i >= 0; --i)
+                {
+                    this->assert_equals(i, stack.pop());
+                }
+                this->assert_true(stack.isEmpty(), "Stack is empty.");
+            }
+        }
+    };
+
+    /**
+     * @brief Tests that threads pushing and popping concurrently lose no element.
+     */
+    class ConcurrentStackTestManyThreads : public LeafTest
+    {
+    public:
+        ConcurrentStackTestManyThreads() :
+            LeafTest("many-threads")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int threadCount = 4;
+            constexpr int perThread = 25'000;
+            adt::ConcurrentStack<int> stack;
+            std::vector<long long> sums(threadCount, 0);
+            std::vector<std::thread> threads;
+
+            for (int t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&stack, &sums, t]()
+                    {
+                        for (int i = 0; i < perThread; ++i)
+                        {
+                            stack.push(t * perThread + i);
+                            int value;
+                            if (stack.tryPop(value))
+                            {
+                                sums[t] += value;
+                            }
+                        }
+                    });
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            long long sum = 0;
+            for (long long partialSum : sums)
+            {
+                sum += partialSum;
+            }
+
+            int value;
+            while (stack.tryPop(value))
+            {
+                sum += value;
+            }
+
+            constexpr long long n = static_cast<long long>(threadCount) * perThread;
+            this->assert_equals(n * (n - 1) / 2, sum);
+            this->assert_true(stack.isEmpty(), "Stack is empty.");
+        }
+    };
+
+    /**
+     * @brief All concurrent stack tests.
+     */
+    class ConcurrentStackTest : public CompositeTest
+    {
+    public:
+        ConcurrentStackTest() :
+            CompositeTest("ConcurrentStack")
+        {
+            this->add_test(std::make_unique<ConcurrentStackTestPushPop>());
+            this->add_test(std::make_unique<ConcurrentStackTestManyThreads>());
+        }
+    };
+}
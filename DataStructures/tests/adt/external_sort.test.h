@@ -0,0 +1,82 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/adt/external_sort.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Sorts a file of random keys with a given memory budget and compares it with std::sort.
+     */
+    class ExternalSortTestBudget : public LeafTest
+    {
+    public:
+        ExternalSortTestBudget(const std::string& name, size_t keyCount, size_t memoryBudget) :
+            LeafTest(name),
+            keyCount_(keyCount),
+            memoryBudget_(memoryBudget),
+            rngKey_(144)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const std::filesystem::path directory = std::filesystem::temp_directory_path();
+            const std::string prefix = "ds-external-sort-test-" + std::string(this->name());
+            const std::filesystem::path input = directory / (prefix + ".in");
+            const std::filesystem::path output = directory / (prefix + ".out");
+
+            std::vector<long long> keys(keyCount_);
+            for (long long& key : keys)
+            {
+                key = static_cast<long long>(rngKey_() % 100'000) - 50'000;
+            }
+            std::ofstream(input, std::ios::binary).write(reinterpret_cast<const char*>(keys.data()), static_cast<std::streamsize>(keys.size() * sizeof(long long)));
+
+            adt::ExternalSort<long long> sorter(memoryBudget_, directory);
+            sorter.sort(input, output, std::greater<long long>());
+
+            std::vector<long long> sortedKeys(keyCount_);
+            std::ifstream result(output, std::ios::binary);
+            result.read(reinterpret_cast<char*>(sortedKeys.data()), static_cast<std::streamsize>(sortedKeys.size() * sizeof(long long)));
+            this->assert_equals(keyCount_, static_cast<size_t>(result.gcount()) / sizeof(long long), "Output has all records.");
+            result.close();
+
+            std::sort(keys.begin(), keys.end(), std::greater<long long>());
+            this->assert_true(keys == sortedKeys, "Output is sorted.");
+            this->assert_equals(keyCount_, sorter.getStatistics().recordCount_, "Statistics count all records.");
+
+            std::filesystem::remove(input);
+            std::filesystem::remove(output);
+        }
+
+    private:
+        size_t keyCount_;
+        size_t memoryBudget_;
+        std::mt19937_64 rngKey_;
+    };
+
+    /**
+     * @brief All external sort tests.
+     */
+    class ExternalSortTest : public CompositeTest
+    {
+    public:
+        ExternalSortTest() :
+            CompositeTest("ExternalSort")
+        {
+            this->add_test(std::make_unique<ExternalSortTestBudget>("empty", 0, 1 << 10));
+            this->add_test(std::make_unique<ExternalSortTestBudget>("single-run", 1'000, 1 << 20));
+            this->add_test(std::make_unique<ExternalSortTestBudget>("single-pass", 100'000, 1 << 20));
+            this->add_test(std::make_unique<ExternalSortTestBudget>("multi-pass", 20'000, 1 << 10));
+        }
+    };
+}
@@ -167,6 +167,150 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests growing and shrinking of the implicit queue ring.
+     */
+    class ImplicitQueueTestGrowShrink : public LeafTest
+    {
+    public:
+        ImplicitQueueTestGrowShrink() :
+            LeafTest("grow-shrink")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 1'000;
+            constexpr size_t capacity = 4;
+
+            adt::ImplicitQueue<int> queue(capacity, true);
+
+            // Wraps the ring before it grows.
+            queue.push(-1);
+            queue.push(-2);
+            queue.pop();
+            queue.pop();
+
+            for (int i = 0; i < n; ++i)
+            {
+                queue.push(i);
+            }
+
+            this->assert_equals(static_cast<size_t>(n), queue.size());
+            this->assert_true(queue.getCapacity() >= static_cast<size_t>(n), "Queue grew.");
+
+            for (int i = 0; i < n - 10; ++i)
+            {
+                this->assert_equals(i, queue.pop());
+            }
+
+            this->assert_true(queue.getCapacity() < static_cast<size_t>(n), "Sparse queue shrank.");
+
+            for (int i = n - 10; i < n; ++i)
+            {
+                this->assert_equals(i, queue.pop());
+            }
+
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests pushBatch and popBatch across the end of the ring.
+     */
+    class ImplicitQueueTestBatch : public LeafTest
+    {
+    public:
+        ImplicitQueueTestBatch() :
+            LeafTest("batch")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t capacity = 8;
+            constexpr size_t n = 20;
+
+            adt::ImplicitQueue<int> queue(capacity);
+            int input[n];
+            int output[n];
+            for (size_t i = 0; i < n; ++i)
+            {
+                input[i] = static_cast<int>(i);
+            }
+
+            queue.pushBatch(input, 6);
+            this->assert_equals(static_cast<size_t>(4), queue.popBatch(output, 4));
+            queue.pushBatch(input + 6, 5);
+            this->assert_equals(capacity, queue.getCapacity());
+            queue.pushBatch(input + 11, n - 11);
+            this->assert_equals(static_cast<size_t>(n - 4), queue.size());
+
+            this->assert_equals(n - 4, queue.popBatch(output + 4, n));
+            bool inOrder = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                inOrder = inOrder && output[i] == static_cast<int>(i);
+            }
+            this->assert_true(inOrder, "Batches preserve FIFO order.");
+            this->assert_equals(static_cast<size_t>(0), queue.popBatch(output, 1));
+        }
+    };
+
+    /**
+     * @brief Tests the unrolled queue across chunk boundaries and reuse of emptied chunks.
+     */
+    class UnrolledQueueTestChunks : public LeafTest
+    {
+    public:
+        UnrolledQueueTestChunks() :
+            LeafTest("chunks")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 100;
+            adt::UnrolledQueue<int, 8> queue;
+
+            for (int i = 0; i < n; ++i)
+            {
+                queue.push(i);
+            }
+            this->assert_equals(static_cast<size_t>(13), queue.getChunkCount());
+
+            int expected = 0;
+            int next = n;
+            for (int round = 0; round < 3; ++round)
+            {
+                for (int i = 0; i < n / 2; ++i)
+                {
+                    this->assert_equals(expected++, queue.pop());
+                }
+                for (int i = 0; i < n / 2; ++i)
+                {
+                    queue.push(next++);
+                }
+            }
+
+            adt::UnrolledQueue<int, 8> copy;
+            for (int i = expected; i < next; ++i)
+            {
+                copy.push(i);
+            }
+            this->assert_true(queue.equals(copy), "Queues with different chunk offsets are equal.");
+
+            while (!queue.isEmpty())
+            {
+                this->assert_equals(expected++, queue.pop());
+            }
+            this->assert_equals(static_cast<size_t>(1), queue.getChunkCount());
+        }
+    };
+
     /**
      * @brief All queue leaf tests.
      * @tparam QueueT Type of the queue.
@@ -195,7 +339,11 @@ namespace ds::tests
             CompositeTest("Queue")
         {
             this->add_test(std::make_unique<GeneralQueueTest<adt::ImplicitQueue<int>>>("ImplicitQueue"));
+            this->add_test(std::make_unique<ImplicitQueueTestGrowShrink>());
+            this->add_test(std::make_unique<ImplicitQueueTestBatch>());
             this->add_test(std::make_unique<GeneralQueueTest<adt::ExplicitQueue<int>>>("ExplicitQueue"));
+            this->add_test(std::make_unique<GeneralQueueTest<adt::UnrolledQueue<int>>>("UnrolledQueue"));
+            this->add_test(std::make_unique<UnrolledQueueTestChunks>());
         }
     };
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include <libds/adt/sorts.h>
 #include <random>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <tests/_details/test.hpp>
 
 namespace ds::tests
@@ -96,6 +99,53 @@ namespace ds::tests
             }
         };
 
+        /**
+         * @brief Generates int keys forming a pattern that is adversarial for naive quicksort.
+         */
+        class PatternIntKeyGenerator
+        {
+        public:
+            enum class Pattern { Sorted, Reversed, Equal, OrganPipe, SortedWithNoise };
+
+            PatternIntKeyGenerator(Pattern pattern, std::mt19937_64& seeder) :
+                pattern_(pattern),
+                rngKey_(seeder())
+            {
+            }
+
+            amt::ImplicitSequence<int> operator()(std::size_t const n)
+            {
+                auto keys = amt::ImplicitSequence<int>(n, false);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    int key = static_cast<int>(i);
+                    switch (pattern_)
+                    {
+                    case Pattern::Reversed:
+                        key = static_cast<int>(n - i);
+                        break;
+                    case Pattern::Equal:
+                        key = 7;
+                        break;
+                    case Pattern::OrganPipe:
+                        key = static_cast<int>(i < n / 2 ? i : n - i);
+                        break;
+                    case Pattern::SortedWithNoise:
+                        key = rngKey_() % 100 == 0 ? static_cast<int>(rngKey_() % n) : key;
+                        break;
+                    default:
+                        break;
+                    }
+                    keys.insertLast().data_ = key;
+                }
+                return keys;
+            }
+
+        private:
+            Pattern pattern_;
+            std::mt19937_64 rngKey_;
+        };
+
         struct StringLengthComparator
         {
             bool operator()(std::string* const lhs, std::string* const rhs) const
@@ -225,6 +275,103 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Creates tests with patterned int keys for @p SortT
+     * @tparam SortT Sort type
+     */
+    template<template<class> class SortT>
+    class PatternSortTest : public CompositeTest
+    {
+    public:
+        PatternSortTest(std::string const& name, std::mt19937_64& seeder, size_t elementCount) :
+            tests::CompositeTest(name)
+        {
+            using namespace details;
+            using Pattern = PatternIntKeyGenerator::Pattern;
+            const std::pair<Pattern, std::string> patterns[] = {
+                { Pattern::Sorted, "sorted" },
+                { Pattern::Reversed, "reversed" },
+                { Pattern::Equal, "equal" },
+                { Pattern::OrganPipe, "organ-pipe" },
+                { Pattern::SortedWithNoise, "sorted-with-noise" }
+            };
+
+            for (auto const& [pattern, patternName] : patterns)
+            {
+                this->add_test(std::make_unique<GenericSortTest<SortT<int>, std::less<>, PatternIntKeyGenerator, IntKeyDisposer>>(
+                    "int-keys-" + patternName + "-" + std::to_string(elementCount),
+                    PatternIntKeyGenerator(pattern, seeder),
+                    IntKeyDisposer(),
+                    std::less<>(),
+                    elementCount
+                ));
+            }
+        }
+    };
+
+    /**
+     * @brief Tests that @p SortT sorts when called through the virtual Sort<T> interface.
+     * @tparam SortT Sort type
+     */
+    template<template<class> class SortT>
+    class VirtualSortTest : public LeafTest
+    {
+    public:
+        VirtualSortTest(std::string const& name, std::mt19937_64& seeder) :
+            LeafTest(name),
+            keyGenerator_(seeder)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto keys = keyGenerator_(1'000);
+            SortT<int> sorter;
+            adt::Sort<int>& sort = sorter;
+            sort.sort(keys);
+            this->assert_true(std::is_sorted(keys.begin(), keys.end()), "Is sorted.");
+        }
+
+    private:
+        details::RandomIntKeyGenerator keyGenerator_;
+    };
+
+    /**
+     * @brief Tests that @p SortT keeps the order of elements with equal keys.
+     * @tparam SortT Sort type
+     */
+    template<template<class> class SortT>
+    class StableSortTest : public LeafTest
+    {
+    public:
+        StableSortTest(std::string const& name, std::mt19937_64& seeder, size_t elementCount) :
+            LeafTest(name),
+            rngKey_(seeder()),
+            elementCount_(elementCount)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using Pair = std::pair<int, size_t>;
+            amt::ImplicitSequence<Pair> keys(elementCount_, false);
+            for (size_t i = 0; i < elementCount_; ++i)
+            {
+                keys.insertLast().data_ = Pair(static_cast<int>(rngKey_() % 16), i);
+            }
+
+            SortT<Pair> sorter;
+            sorter.sort(keys, [](const Pair& lhs, const Pair& rhs) { return lhs.first < rhs.first; });
+            this->assert_true(std::is_sorted(keys.begin(), keys.end()), "Equal keys keep their order.");
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+        size_t elementCount_;
+    };
+
     /**
      * @brief Special test case for radix sort
      */
@@ -243,6 +390,306 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests radix sort with negative integer keys, floating point keys, and in parallel.
+     */
+    class RadixSortTestKeys : public LeafTest
+    {
+    public:
+        RadixSortTestKeys(std::mt19937_64& seeder) :
+            LeafTest("RadixSort-keys"),
+            rngKey_(seeder())
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            amt::ImplicitSequence<long long> integers;
+            for (int i = 0; i < 10'000; ++i)
+            {
+                integers.insertLast().data_ = static_cast<long long>(rngKey_()) >> (i % 40);
+            }
+            adt::RadixSort<long long, long long>().sort(integers);
+            this->assert_true(std::is_sorted(integers.begin(), integers.end()), "Signed keys are sorted.");
+
+            std::uniform_real_distribution<double> coordinateDist(-180.0, 180.0);
+            amt::ImplicitSequence<double> coordinates;
+            for (int i = 0; i < 10'000; ++i)
+            {
+                coordinates.insertLast().data_ = coordinateDist(rngKey_);
+            }
+            adt::RadixSort<std::uint64_t, double>(adt::RadixKeys::fromDouble).sort(coordinates);
+            this->assert_true(std::is_sorted(coordinates.begin(), coordinates.end()), "Floating point keys are sorted.");
+
+            amt::ImplicitSequence<int> large;
+            for (int i = 0; i < 1'200'000; ++i)
+            {
+                large.insertLast().data_ = static_cast<int>(rngKey_());
+            }
+            adt::RadixSort<int, int>([](const int& key) { return key; }, true).sort(large);
+            this->assert_true(std::is_sorted(large.begin(), large.end()), "Parallel sort is sorted.");
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+    };
+
+    /**
+     * @brief Tests sorting by string keys with long common prefixes and by composite keys.
+     */
+    class MultikeyQuickSortTest : public LeafTest
+    {
+    public:
+        MultikeyQuickSortTest(std::mt19937_64& seeder) :
+            LeafTest("MultikeyQuickSort"),
+            rngKey_(seeder())
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // Blocks are relocated without running constructors, so the strings are referenced.
+            using Pair = std::pair<std::string, std::string>;
+            const size_t count = 10'000;
+
+            std::vector<std::string> strings;
+            amt::ImplicitSequence<const std::string*> stringRefs;
+            strings.reserve(count + 1);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string prefix(rngKey_() % 40, 'a');
+                strings.push_back(prefix + std::to_string(rngKey_() % 1'000));
+            }
+            strings.push_back("");
+            for (const std::string& string : strings)
+            {
+                stringRefs.insertLast().data_ = &string;
+            }
+            adt::MultikeyQuickSort<const std::string*>([](const std::string* const& key) { return std::string_view(*key); }).sort(stringRefs);
+            this->assert_true(std::is_sorted(stringRefs.begin(), stringRefs.end(), [](const std::string* a, const std::string* b) { return *a < *b; }), "Strings are sorted.");
+
+            std::vector<Pair> pairs;
+            amt::ImplicitSequence<const Pair*> pairRefs;
+            pairs.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                pairs.push_back({ "municipality-" + std::to_string(rngKey_() % 20), "street-" + std::to_string(rngKey_() % 50) });
+                pairRefs.insertLast().data_ = &pairs.back();
+            }
+            adt::MultikeyQuickSort<const Pair*>({
+                [](const Pair* const& pair) { return std::string_view(pair->first); },
+                [](const Pair* const& pair) { return std::string_view(pair->second); }
+            }).sort(pairRefs);
+            this->assert_true(std::is_sorted(pairRefs.begin(), pairRefs.end(), [](const Pair* a, const Pair* b) { return *a < *b; }), "Composite keys are sorted.");
+
+            // Records need not be comparable, only their keys are.
+            struct Record { const std::string* name_; };
+            amt::ImplicitSequence<Record> records;
+            for (const std::string& string : strings)
+            {
+                records.insertLast().data_.name_ = &string;
+            }
+            adt::MultikeyQuickSort<Record>([](const Record& record) { return std::string_view(*record.name_); }).sort(records);
+            this->assert_true(std::is_sorted(records.begin(), records.end(), [](const Record& a, const Record& b) { return *a.name_ < *b.name_; }), "Records are sorted by the key.");
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+    };
+
+    /**
+     * @brief Tests partial sort and selection against a fully sorted copy.
+     */
+    class SelectionTest : public LeafTest
+    {
+    public:
+        SelectionTest(std::mt19937_64& seeder) :
+            LeafTest("Selection"),
+            rngKey_(seeder())
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t size = 10'000;
+            const size_t count = 100;
+
+            amt::ImplicitSequence<int> keys;
+            for (size_t i = 0; i < size; ++i)
+            {
+                keys.insertLast().data_ = static_cast<int>(rngKey_() % 1'000);
+            }
+            amt::ImplicitSequence<int> sorted(keys);
+            adt::IntroSort<int>().sort(sorted, std::less<int>());
+
+            amt::ImplicitSequence<int> partial(keys);
+            adt::partialSort(partial, count);
+            bool prefixSorted = true;
+            for (size_t i = 0; i < count; ++i)
+            {
+                prefixSorted = prefixSorted && partial.access(i)->data_ == sorted.access(i)->data_;
+            }
+            this->assert_true(prefixSorted, "First elements are the least ones, sorted.");
+
+            amt::ImplicitSequence<int> selected(keys);
+            const size_t median = size / 2;
+            adt::nthElement(selected, median, std::greater<int>());
+            const int nth = selected.access(median)->data_;
+            bool partitioned = true;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const int key = selected.access(i)->data_;
+                partitioned = partitioned && (i < median ? key >= nth : key <= nth);
+            }
+            this->assert_equals(sorted.access(size - 1 - median)->data_, nth, "Nth element is the one sorted order puts there.");
+            this->assert_true(partitioned, "No element before the nth one follows it and vice versa.");
+            this->assert_throws([&]() { adt::nthElement(selected, size); }, "Index out of range throws.");
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+    };
+
+    /**
+     * @brief Tests that argsort orders indices stably by key and that the permutation reorders the elements.
+     */
+    class ArgsortTest : public LeafTest
+    {
+    public:
+        ArgsortTest(std::mt19937_64& seeder) :
+            LeafTest("Argsort"),
+            rngKey_(seeder())
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t size = 10'000;
+
+            amt::ImplicitSequence<int> keys;
+            for (size_t i = 0; i < size; ++i)
+            {
+                keys.insertLast().data_ = static_cast<int>(rngKey_() % 1'000);
+            }
+            const auto byTens = [](const int& key) { return key / 10; };
+
+            amt::ImplicitSequence<std::uint32_t> order = adt::argsort(keys, byTens);
+            this->assert_equals(size, order.size(), "Order has an index for each element.");
+            bool stable = true;
+            for (size_t i = 1; i < size; ++i)
+            {
+                const std::uint32_t previous = order.access(i - 1)->data_;
+                const std::uint32_t current = order.access(i)->data_;
+                const int previousKey = byTens(keys.access(previous)->data_);
+                const int currentKey = byTens(keys.access(current)->data_);
+                stable = stable && (previousKey < currentKey || (previousKey == currentKey && previous < current));
+            }
+            this->assert_true(stable, "Indices are ordered by key, equal keys by index.");
+
+            amt::ImplicitSequence<int> permuted(keys);
+            adt::applyPermutation(permuted, order);
+            bool applied = true;
+            for (size_t i = 0; i < size; ++i)
+            {
+                applied = applied && permuted.access(i)->data_ == keys.access(order.access(i)->data_)->data_;
+            }
+            this->assert_true(applied, "Each element is moved to the position of its index.");
+
+            order.access(0)->data_ = order.access(1)->data_;
+            this->assert_throws([&]() { adt::applyPermutation(permuted, order); }, "Repeated index throws.");
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+    };
+
+    /**
+     * @brief Tests sorting networks on all 0-1 inputs, which by the 0-1 principle covers all inputs,
+     *        and on random floating point keys.
+     */
+    class SortingNetworkTest : public LeafTest
+    {
+    public:
+        SortingNetworkTest(std::mt19937_64& seeder) :
+            LeafTest("SortingNetwork"),
+            rngKey_(seeder())
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            this->assert_true(
+                sortsAllZeroOneInputs(std::make_index_sequence<adt::SortingNetworks::MAX_SIZE + 1>()),
+                "Networks of all sizes sort all 0-1 inputs.");
+            this->assert_equals(size_t{ 60 }, adt::SortingNetwork<16>::comparatorCount(), "Network for 16 keys has 60 comparators.");
+
+            bool sorted = true;
+            for (size_t size = 0; size <= adt::SortingNetworks::MAX_SIZE; ++size)
+            {
+                amt::ImplicitSequence<double> keys;
+                std::vector<double> expected;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const double key = static_cast<double>(rngKey_() % 10) / 4;
+                    keys.insertLast().data_ = key;
+                    expected.push_back(key);
+                }
+                adt::networkSort(keys, std::greater<double>());
+                std::sort(expected.begin(), expected.end(), std::greater<double>());
+                for (size_t i = 0; i < size; ++i)
+                {
+                    sorted = sorted && keys.access(i)->data_ == expected[i];
+                }
+            }
+            this->assert_true(sorted, "Random keys are sorted in descending order.");
+
+            amt::ImplicitSequence<int> tooLong;
+            for (size_t i = 0; i <= adt::SortingNetworks::MAX_SIZE; ++i)
+            {
+                tooLong.insertLast().data_ = static_cast<int>(i);
+            }
+            this->assert_throws([&]() { adt::networkSort(tooLong); }, "Sequence longer than the longest network throws.");
+        }
+
+    private:
+        template<size_t... Size>
+        static bool sortsAllZeroOneInputs(std::index_sequence<Size...>)
+        {
+            return (sortsAllZeroOneInputs<Size>() && ...);
+        }
+
+        template<size_t Size>
+        static bool sortsAllZeroOneInputs()
+        {
+            std::less<int> compare;
+            amt::MemoryBlock<int> blocks[Size + 1];
+            for (size_t bits = 0; bits < (size_t{ 1 } << Size); ++bits)
+            {
+                for (size_t i = 0; i < Size; ++i)
+                {
+                    blocks[i].data_ = static_cast<int>((bits >> i) & 1);
+                }
+                adt::SortingNetwork<Size>::sort(blocks, compare);
+                for (size_t i = 1; i < Size; ++i)
+                {
+                    if (blocks[i - 1].data_ > blocks[i].data_)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+    private:
+        std::mt19937_64 rngKey_;
+    };
+
     /**
      * @brief All sort tests
      */
@@ -256,15 +703,32 @@ namespace ds::tests
 
             auto const smallNs = { 1,2,3,100 };
             auto const bigNs = { 1,2,3,10'000 };
+            auto const parallelNs = { 1,2,3,10'000,100'000 };
 
             this->add_test(std::make_unique<MultiCmpSortTest<adt::SelectSort>>("SelectSort", seeder, smallNs));
             this->add_test(std::make_unique<MultiCmpSortTest<adt::BubbleSort>>("BubbleSort", seeder, smallNs));
             this->add_test(std::make_unique<MultiCmpSortTest<adt::InsertSort>>("InsertSort", seeder, smallNs));
             this->add_test(std::make_unique<MultiCmpSortTest<adt::QuickSort>>("QuickSort", seeder, bigNs));
+            this->add_test(std::make_unique<MultiCmpSortTest<adt::IntroSort>>("IntroSort", seeder, bigNs));
+            this->add_test(std::make_unique<PatternSortTest<adt::IntroSort>>("IntroSort-patterns", seeder, 100'000));
+            this->add_test(std::make_unique<VirtualSortTest<adt::IntroSort>>("IntroSort-virtual", seeder));
             this->add_test(std::make_unique<MultiCmpSortTest<adt::HeapSort>>("HeapSort", seeder, bigNs));
             this->add_test(std::make_unique<MultiCmpSortTest<adt::ShellSort>>("ShellSort", seeder, bigNs));
             this->add_test(std::make_unique<MultiCmpSortTest<adt::MergeSort>>("MergeSort", seeder, bigNs));
+            this->add_test(std::make_unique<StableSortTest<adt::MergeSort>>("MergeSort-stable", seeder, 10'000));
+            this->add_test(std::make_unique<MultiCmpSortTest<adt::ParallelMergeSort>>("ParallelMergeSort", seeder, parallelNs));
+            this->add_test(std::make_unique<StableSortTest<adt::ParallelMergeSort>>("ParallelMergeSort-stable", seeder, 100'000));
+            this->add_test(std::make_unique<MultiCmpSortTest<adt::SampleSort>>("SampleSort", seeder, parallelNs));
+            this->add_test(std::make_unique<PatternSortTest<adt::SampleSort>>("SampleSort-patterns", seeder, 100'000));
+            this->add_test(std::make_unique<MultiCmpSortTest<adt::TimSort>>("TimSort", seeder, bigNs));
+            this->add_test(std::make_unique<PatternSortTest<adt::TimSort>>("TimSort-patterns", seeder, 100'000));
+            this->add_test(std::make_unique<StableSortTest<adt::TimSort>>("TimSort-stable", seeder, 100'000));
             this->add_test(std::make_unique<RadixSortTest>(seeder));
+            this->add_test(std::make_unique<RadixSortTestKeys>(seeder));
+            this->add_test(std::make_unique<MultikeyQuickSortTest>(seeder));
+            this->add_test(std::make_unique<SelectionTest>(seeder));
+            this->add_test(std::make_unique<ArgsortTest>(seeder));
+            this->add_test(std::make_unique<SortingNetworkTest>(seeder));
         }
     };
 }
\ No newline at end of file
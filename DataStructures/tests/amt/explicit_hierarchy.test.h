@@ -1,10 +1,12 @@
 #pragma once
 
 #include <libds/amt/explicit_hierarchy.h>
+#include <libds/mm/pool_memory_manager.h>
 #include <tests/_details/test.hpp>
 #include <tests/amt/hierarchy.test.h>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace ds::tests
 {
@@ -227,6 +229,78 @@ namespace ds::tests
         }
     };
 
+    /**
+     *  @brief Tests that compaction places nodes next to each other in traversal order.
+     */
+    class MWEHTestCompact : public LeafTest
+    {
+    public:
+        MWEHTestCompact() :
+            LeafTest("compact")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using BlockType = amt::MultiWayExplicitHierarchy<int>::BlockType;
+            auto fixture = details::makeMWEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            const auto original(hierarchy);
+
+            // The default manager is replaced by a pool.
+            hierarchy.compact();
+            this->assert_true(hierarchy.equals(original), "Compacted hierarchy is the same.");
+            this->assert_true(this->isCompact(hierarchy, fixture.preOrder_, false), "Nodes are adjacent in pre-order.");
+
+            // The pool is kept, so the nodes are adjacent again.
+            hierarchy.compact(amt::CompactionOrder::LevelOrder);
+            this->assert_true(hierarchy.equals(original), "Compacted hierarchy is the same.");
+            this->assert_true(this->isCompact(hierarchy, fixture.levelOrder_, true), "Nodes are adjacent in level order.");
+
+            hierarchy.compact(amt::CompactionOrder::PreOrder, new mm::PoolMemoryManager<BlockType>(hierarchy.size()));
+            this->assert_true(hierarchy.equals(original), "Compacted hierarchy is the same.");
+            this->assert_true(this->isCompact(hierarchy, fixture.preOrder_, false), "Nodes are adjacent in pre-order.");
+
+            BlockType& root = *hierarchy.accessRoot();
+            hierarchy.emplaceSon(*hierarchy.accessSon(root, 1), 1).data_ = 7;
+            hierarchy.removeSon(root, 0);
+            this->assert_equals(static_cast<size_t>(4), hierarchy.size());
+            this->assert_equals(7, hierarchy.accessSon(*hierarchy.accessSon(root, 0), 1)->data_);
+
+            amt::MultiWayExplicitHierarchy<int> empty;
+            empty.compact();
+            this->assert_true(empty.isEmpty(), "Empty hierarchy stays empty.");
+        }
+
+    private:
+        bool isCompact(amt::MultiWayExplicitHierarchy<int>& hierarchy, const std::vector<int>& order, bool levelOrder)
+        {
+            using BlockType = amt::MultiWayExplicitHierarchy<int>::BlockType;
+            std::vector<BlockType*> nodes;
+            auto collect = [&nodes](const BlockType* b) { nodes.push_back(const_cast<BlockType*>(b)); };
+            if (levelOrder)
+            {
+                hierarchy.processLevelOrder(hierarchy.accessRoot(), collect);
+            }
+            else
+            {
+                hierarchy.processPreOrder(hierarchy.accessRoot(), collect);
+            }
+
+            bool result = nodes.size() == order.size();
+            for (size_t i = 0; result && i < nodes.size(); ++i)
+            {
+                result = nodes[i]->data_ == order[i] && nodes[i] == nodes[0] + i;
+                for (size_t son = 0; result && son < hierarchy.degree(*nodes[i]); ++son)
+                {
+                    result = hierarchy.accessParent(*hierarchy.accessSon(*nodes[i], son)) == nodes[i];
+                }
+            }
+            return result;
+        }
+    };
+
     /**
      * @brief All MultiwayExplicitHierarchy tests.
      */
@@ -242,6 +316,7 @@ namespace ds::tests
             this->add_test(std::make_unique<MWEHTestRemove>());
             this->add_test(std::make_unique<MWEHTestCopyAssignEquals>());
             this->add_test(std::make_unique<MWEHTestClear>());
+            this->add_test(std::make_unique<MWEHTestCompact>());
         }
     };
 
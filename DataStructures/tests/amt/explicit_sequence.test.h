@@ -3,10 +3,82 @@
 #include <tests/_details/test.hpp>
 #include <tests/amt/sequence.test.h>
 #include <libds/amt/explicit_sequence.h>
+#include <libds/mm/pool_memory_manager.h>
 #include <memory>
 
 namespace ds::tests
 {
+    /**
+     * @brief Tests that compaction places blocks next to each other in sequence order.
+     */
+    template<class SequenceT>
+    class ExplicitSequenceTestCompact : public LeafTest
+    {
+    public:
+        ExplicitSequenceTestCompact() :
+            LeafTest("compact")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            SequenceT sequence;
+            const int n = 100;
+            for (int i = 0; i < n; ++i)
+            {
+                if (i % 2 == 0)
+                {
+                    sequence.insertLast().data_ = i;
+                }
+                else
+                {
+                    sequence.insertFirst().data_ = i;
+                }
+            }
+            for (int i = 0; i < n / 4; ++i)
+            {
+                sequence.remove(static_cast<size_t>(3 * i) % sequence.size());
+            }
+            const SequenceT original(sequence);
+
+            // The default manager is replaced by a pool.
+            sequence.compact();
+            this->assert_true(sequence.equals(original), "Compacted sequence is the same.");
+            this->assert_true(this->isAdjacent(sequence), "Blocks are adjacent in sequence order.");
+            this->assert_equals(original.accessLast()->data_, sequence.accessLast()->data_);
+            this->assert_equals(original.accessLast()->data_, sequence.access(sequence.size() - 1)->data_);
+
+            sequence.insert(10).data_ = -1;
+            sequence.removeLast();
+            sequence.removeFirst();
+            this->assert_equals(-1, sequence.access(9)->data_);
+            this->assert_equals(original.size() - 1, sequence.size());
+
+            // The pool is kept, so blocks inserted since are adjacent again too.
+            sequence.compact();
+            this->assert_true(this->isAdjacent(sequence), "Blocks are adjacent after compaction into the same kind of manager.");
+            this->assert_equals(-1, sequence.access(9)->data_);
+
+            sequence.compact(new mm::PoolMemoryManager<typename SequenceT::BlockType>(sequence.size()));
+            this->assert_true(this->isAdjacent(sequence), "Blocks are adjacent after compaction into a given manager.");
+            this->assert_equals(original.size() - 1, sequence.size());
+        }
+
+    private:
+        bool isAdjacent(SequenceT& sequence)
+        {
+            auto* first = sequence.accessFirst();
+            size_t offset = 0;
+            bool adjacent = true;
+            for (auto* block = first; block != nullptr; block = sequence.accessNext(*block))
+            {
+                adjacent = adjacent && block == first + offset++;
+            }
+            return adjacent && offset == sequence.size();
+        }
+    };
+
     /**
      * @brief All tests for singly linked sequence.
      */
@@ -17,6 +89,7 @@ namespace ds::tests
             CompositeTest("SinglyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::SinglyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestCompact<amt::SinglyLinkedSequence<int>>>());
         }
     };
 
@@ -30,6 +103,7 @@ namespace ds::tests
             CompositeTest("DoublyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::DoublyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<ExplicitSequenceTestCompact<amt::DoublyLinkedSequence<int>>>());
         }
     };
 
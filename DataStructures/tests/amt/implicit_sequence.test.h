@@ -67,6 +67,88 @@ namespace ds::tests
         }
     };
 
+    /**
+     *  @brief Tests that a small sequence keeps its elements inline until it overflows.
+     */
+    class SmallImplicitSequenceTestInline : public LeafTest
+    {
+    public:
+        SmallImplicitSequenceTestInline() :
+            LeafTest("small inline")
+        {
+        }
+
+        void test() override
+        {
+            constexpr int n = 4;
+
+            amt::SmallImplicitSequence<int, n> seq;
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertFirst().data_ = i;
+            }
+            this->assert_true(seq.isInline(), "Sequence of inline capacity stays inline.");
+            this->assert_equals(n * sizeof(amt::MemoryBlock<int>), seq.getMemoryStatistics().capacitySize_);
+
+            amt::SmallImplicitSequence<int, n> copy(seq);
+            this->assert_true(copy.isInline(), "Copy of an inline sequence is inline.");
+            this->assert_true(copy.equals(seq), "Copy equals the original.");
+
+            seq.insertLast().data_ = n;
+            this->assert_false(seq.isInline(), "Overflowing sequence moves to the heap.");
+            for (int i = 0; i < n; ++i)
+            {
+                this->assert_equals(n - 1 - i, seq.access(i)->data_);
+            }
+            this->assert_equals(n, seq.accessLast()->data_);
+
+            copy.assign(seq);
+            this->assert_false(copy.isInline(), "Assigned sequence that does not fit moves to the heap.");
+            this->assert_true(copy.equals(seq), "Assigned sequence equals the original.");
+        }
+    };
+
+    /**
+     *  @brief Tests that walking a gap buffer sequence keeps the gap and pointers to its blocks.
+     */
+    class ImplicitSequenceTestGapBufferWalk : public LeafTest
+    {
+    public:
+        ImplicitSequenceTestGapBufferWalk() :
+            LeafTest("gap buffer walk")
+        {
+        }
+
+        void test() override
+        {
+            constexpr int n = 20;
+
+            amt::ImplicitSequence<int> seq;
+            seq.setGapBuffer(true);
+            for (int i = 0; i < n; ++i)
+            {
+                seq.insertLast().data_ = i;
+            }
+            seq.insert(n / 2).data_ = n;
+
+            const size_t index = n / 2 + 1;
+            amt::MemoryBlock<int>* block = seq.access(index);
+            this->assert_true(block != seq.access(index - 1) + 1, "Insertion in the middle opens a gap.");
+
+            int sum = 0;
+            seq.processAllBlocksForward([&sum](amt::MemoryBlock<int>* b) { sum += b->data_; });
+            this->assert_equals(n * (n + 1) / 2, sum);
+            this->assert_true(block == seq.access(index), "Walk keeps pointers to blocks valid.");
+            this->assert_equals(n / 2, block->data_);
+
+            seq.makeContiguous();
+            for (size_t i = 1; i < seq.size(); ++i)
+            {
+                this->assert_true(seq.access(i) == seq.accessFirst() + i, "Contiguous blocks are adjacent.");
+            }
+        }
+    };
+
     /**
      *  @brief All ImplicitSequenceTests.
      */
@@ -79,6 +161,9 @@ namespace ds::tests
             this->add_test(std::make_unique<GenericSequenceTest<amt::ImplicitSequence<int>>>());
             this->add_test(std::make_unique<ImplicitSequenceTestIndexOfRelative>());
             this->add_test(std::make_unique<CyclicImplicitSequenceTestIndexOfRelative>());
+            this->add_test(std::make_unique<GenericSequenceTest<amt::SmallImplicitSequence<int, 4>>>());
+            this->add_test(std::make_unique<SmallImplicitSequenceTestInline>());
+            this->add_test(std::make_unique<ImplicitSequenceTestGapBufferWalk>());
         }
     };
 }
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/exec/thread_pool.h>
+#include <libds/exec/work_stealing_deque.h>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests owner and thief ends of the work-stealing deque, including growth.
+     */
+    class WorkStealingDequeTest : public LeafTest
+    {
+    public:
+        WorkStealingDequeTest() :
+            LeafTest("WorkStealingDeque")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+            int items[n];
+            exec::WorkStealingDeque<int> deque(4);
+
+            this->assert_true(deque.take() == nullptr, "Empty deque can't take.");
+            this->assert_true(deque.steal() == nullptr, "Empty deque can't steal.");
+
+            for (int i = 0; i < n; ++i)
+            {
+                items[i] = i;
+                deque.push(&items[i]);
+            }
+
+            this->assert_equals(0, *deque.steal());
+            this->assert_equals(1, *deque.steal());
+            for (int i = n - 1; i >= 2; --i)
+            {
+                this->assert_equals(i, *deque.take());
+            }
+            this->assert_true(deque.isEmpty(), "Deque is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests that submitted tasks deliver their results through futures.
+     */
+    class ThreadPoolTestSubmit : public LeafTest
+    {
+    public:
+        ThreadPoolTestSubmit() :
+            LeafTest("submit")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 100;
+            exec::ThreadPool pool(4);
+            std::vector<std::future<int>> results;
+
+            for (int i = 0; i < n; ++i)
+            {
+                results.push_back(pool.submit([i]() { return i * i; }));
+            }
+
+            for (int i = 0; i < n; ++i)
+            {
+                this->assert_equals(i * i, results[i].get());
+            }
+        }
+    };
+
+    /**
+     * @brief Tests nested invoke and propagation of exceptions from forked tasks.
+     */
+    class ThreadPoolTestInvoke : public LeafTest
+    {
+    public:
+        ThreadPoolTestInvoke() :
+            LeafTest("invoke")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            exec::ThreadPool pool(2);
+            this->assert_equals(static_cast<size_t>(2), pool.getThreadCount());
+            this->assert_equals(832040LL, this->fibonacci(pool, 30));
+
+            this->assert_throws([&pool]()
+                {
+                    pool.invoke([]() {}, []() { throw std::runtime_error("forked"); });
+                },
+                "Exception of forked task is rethrown"
+            );
+        }
+
+    private:
+        long long fibonacci(exec::ThreadPool& pool, int n)
+        {
+            if (n < 20)
+            {
+                return n < 2 ? n : this->fibonacci(pool, n - 1) + this->fibonacci(pool, n - 2);
+            }
+
+            long long a = 0;
+            long long b = 0;
+            pool.invoke(
+                [this, &pool, &a, n]() { a = this->fibonacci(pool, n - 1); },
+                [this, &pool, &b, n]() { b = this->fibonacci(pool, n - 2); }
+            );
+            return a + b;
+        }
+    };
+
+    /**
+     * @brief Tests that parallelFor visits every index exactly once.
+     */
+    class ThreadPoolTestParallelFor : public LeafTest
+    {
+    public:
+        ThreadPoolTestParallelFor() :
+            LeafTest("parallel-for")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr size_t n = 100'000;
+            exec::ThreadPool pool(4);
+            std::vector<std::atomic<int>> visits(n);
+
+            pool.parallelFor(0, n, 64, [&visits](size_t i)
+                {
+                    visits[i].fetch_add(1, std::memory_order_relaxed);
+                });
+
+            bool allOnce = true;
+            for (const std::atomic<int>& visit : visits)
+            {
+                allOnce = allOnce && visit.load() == 1;
+            }
+            this->assert_true(allOnce, "Each index visited once.");
+
+            size_t calls = 0;
+            pool.parallelFor(5, 5, 1, [&calls](size_t) { ++calls; });
+            this->assert_equals(static_cast<size_t>(0), calls);
+        }
+    };
+
+    /**
+     * @brief All thread pool tests.
+     */
+    class ThreadPoolTest : public CompositeTest
+    {
+    public:
+        ThreadPoolTest() :
+            CompositeTest("ThreadPool")
+        {
+            this->add_test(std::make_unique<ThreadPoolTestSubmit>());
+            this->add_test(std::make_unique<ThreadPoolTestInvoke>());
+            this->add_test(std::make_unique<ThreadPoolTestParallelFor>());
+        }
+    };
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/arena_memory_manager.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <memory>
+#include <string>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests that blocks are bump-allocated and that released blocks are not reused.
+     */
+    class ArenaMemoryManagerTestAllocate : public LeafTest
+    {
+    public:
+        ArenaMemoryManagerTestAllocate() :
+            LeafTest("allocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::ArenaMemoryManager<int> manager(16);
+            int* first = manager.allocateMemory();
+            int* second = manager.allocateMemory();
+            manager.releaseMemory(first);
+            int* third = manager.allocateMemory();
+
+            this->assert_equals(first + 1, second, "Blocks are adjacent.");
+            this->assert_equals(first + 2, third, "Released block is not reused.");
+            this->assert_equals(size_t{ 2 }, manager.getAllocatedBlockCount());
+
+            for (int i = 0; i < 100; ++i)
+            {
+                *manager.allocateMemory() = i;
+            }
+            this->assert_equals(size_t{ 3 }, manager.getChunkCount(), "Chunks double in size.");
+            this->assert_equals(size_t{ 16 + 32 + 64 }, manager.getCapacity());
+        }
+    };
+
+    /**
+     * @brief Tests that reset destroys all blocks, released ones included, and frees all chunks.
+     */
+    class ArenaMemoryManagerTestReset : public LeafTest
+    {
+    public:
+        ArenaMemoryManagerTestReset() :
+            LeafTest("reset")
+        {
+        }
+
+    protected:
+        struct Counted
+        {
+            Counted() { ++live_; }
+            ~Counted() { --live_; }
+            static inline int live_ = 0;
+            std::string name_ = std::string(32, 'x');
+        };
+
+        void test() override
+        {
+            mm::ArenaMemoryManager<Counted> manager(4);
+            for (int i = 0; i < 10; ++i)
+            {
+                Counted* block = manager.allocateMemory();
+                if (i % 2 == 0)
+                {
+                    manager.releaseMemory(block);
+                }
+            }
+            this->assert_equals(10, Counted::live_, "Released blocks are alive until reset.");
+            this->assert_equals(size_t{ 5 }, manager.getAllocatedBlockCount());
+
+            manager.reset();
+            this->assert_equals(0, Counted::live_, "Reset destroys all blocks.");
+            this->assert_equals(size_t{ 0 }, manager.getChunkCount());
+            this->assert_equals(size_t{ 0 }, manager.getAllocatedBlockCount());
+
+            manager.allocateMemory();
+            this->assert_equals(size_t{ 4 }, manager.getCapacity(), "Chunks start small again.");
+        }
+    };
+
+    /**
+     * @brief Tests a hierarchy whose blocks are allocated by an arena.
+     */
+    class ArenaMemoryManagerTestHierarchy : public LeafTest
+    {
+    public:
+        ArenaMemoryManagerTestHierarchy() :
+            LeafTest("hierarchy")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using BlockType = amt::MultiWayExplicitHierarchy<std::string>::BlockType;
+            amt::MultiWayExplicitHierarchy<std::string> hierarchy(new mm::ArenaMemoryManager<BlockType>());
+            BlockType& root = hierarchy.emplaceRoot();
+            root.data_ = "root";
+            for (size_t i = 0; i < 100; ++i)
+            {
+                BlockType& son = hierarchy.emplaceSon(root, i);
+                son.data_ = std::string(32, static_cast<char>('a' + i % 26));
+                hierarchy.emplaceSon(son, 0).data_ = son.data_;
+            }
+
+            this->assert_equals(size_t{ 201 }, hierarchy.size());
+            hierarchy.removeSon(root, 0);
+            this->assert_equals(size_t{ 199 }, hierarchy.size());
+            this->assert_equals(std::string(32, 'b'), hierarchy.accessSon(root, 0)->data_);
+
+            hierarchy.clear();
+            this->assert_true(hierarchy.isEmpty(), "Cleared hierarchy is empty.");
+            this->assert_equals(size_t{ 0 }, hierarchy.getMemoryStatistics().liveBlockCount_);
+            this->assert_equals(size_t{ 0 }, hierarchy.getMemoryStatistics().capacitySize_);
+            hierarchy.emplaceRoot().data_ = "root";
+            this->assert_equals(size_t{ 1 }, hierarchy.size());
+        }
+    };
+
+    /**
+     * @brief All arena memory manager tests.
+     */
+    class ArenaMemoryManagerTest : public CompositeTest
+    {
+    public:
+        ArenaMemoryManagerTest() :
+            CompositeTest("ArenaMemoryManager")
+        {
+            this->add_test(std::make_unique<ArenaMemoryManagerTestAllocate>());
+            this->add_test(std::make_unique<ArenaMemoryManagerTestReset>());
+            this->add_test(std::make_unique<ArenaMemoryManagerTestHierarchy>());
+        }
+    };
+}
@@ -2,7 +2,10 @@
 
 #include <tests/_details/test.hpp>
 #include <libds/mm/compact_memory_manager.h>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ds::tests
 {
@@ -381,6 +384,307 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests capacities given by a growth policy.
+     */
+    class CompactMemoryManagerTestGrowth : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestGrowth() :
+            LeafTest("growth")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::GrowthPolicy policy;
+            policy.factor_ = 1.5;
+            policy.minStep_ = 10;
+            policy.maxStep_ = 100;
+
+            this->assert_equals(size_t{ 10 }, policy.nextCapacity(0), "Minimal step.");
+            this->assert_equals(size_t{ 150 }, policy.nextCapacity(100));
+            this->assert_equals(size_t{ 1100 }, policy.nextCapacity(1000), "Maximal step.");
+
+            mm::CompactMemoryManager<int> manager(0);
+            manager.setGrowthPolicy(policy);
+            *manager.allocateMemory() = 0;
+            this->assert_equals(size_t{ 10 }, manager.getCapacity(), "Empty manager grows.");
+
+            for (int i = 1; i < 11; ++i)
+            {
+                *manager.allocateMemory() = i;
+            }
+            this->assert_equals(size_t{ 20 }, manager.getCapacity());
+            this->assert_equals(10, manager.getBlockAt(10));
+
+            mm::CompactMemoryManager<int> copy(manager);
+            this->assert_equals(size_t{ 100 }, copy.getGrowthPolicy().maxStep_, "Copy keeps the policy.");
+        }
+    };
+
+    /**
+     * @brief Tests that blocks keep their values when the buffer moves.
+     */
+    class CompactMemoryManagerTestRelocate : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestRelocate() :
+            LeafTest("relocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::CompactMemoryManager<std::string> strings;
+            const int n = 100;
+            for (int i = 0; i < n; ++i)
+            {
+                *strings.allocateMemory() = std::to_string(i) + (i % 2 == 0 ? "" : std::string(40, '-'));
+            }
+            bool keptStrings = true;
+            for (int i = 0; i < n; ++i)
+            {
+                keptStrings = keptStrings && strings.getBlockAt(i).compare(0, std::to_string(i).size(), std::to_string(i)) == 0;
+            }
+            this->assert_true(keptStrings, "Strings are moved, not copied bytewise.");
+
+            // Large buffers may be mapped, growing and shrinking must keep the blocks in either case.
+            const size_t count = size_t{ 1 } << 21;
+            mm::CompactMemoryManager<long long> numbers;
+            numbers.changeCapacity(count / 2);
+            for (size_t i = 0; i < count; ++i)
+            {
+                *numbers.allocateMemory() = static_cast<long long>(i);
+            }
+            numbers.changeCapacity(4 * count);
+            numbers.changeCapacity(count + 1);
+            bool keptNumbers = true;
+            for (size_t i = 0; i < count; ++i)
+            {
+                keptNumbers = keptNumbers && numbers.getBlockAt(i) == static_cast<long long>(i);
+            }
+            this->assert_true(keptNumbers, "Numbers are kept.");
+
+            numbers.changeCapacity(16);
+            this->assert_equals(size_t{ 16 }, numbers.getAllocatedBlockCount());
+            this->assert_equals(15LL, numbers.getBlockAt(15));
+        }
+    };
+
+    /**
+     * @brief Tests backends of small and large buffers.
+     */
+    class CompactMemoryManagerTestStorage : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestStorage() :
+            LeafTest("storage")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::CompactMemoryManager<long long> small;
+            this->assert_true(small.getStorageBackend() == mm::StorageBackend::Heap, "Small buffer is on the heap.");
+            this->assert_true(small.getPageSize() > 0, "Page size is known.");
+
+            mm::StoragePolicy policy;
+            policy.mapThreshold_ = size_t{ 1 } << 20;
+            policy.populate_ = true;
+            mm::CompactMemoryManager<long long> large;
+            large.setStoragePolicy(policy);
+
+            const size_t count = size_t{ 1 } << 18;
+            large.changeCapacity(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                *large.allocateMemory() = static_cast<long long>(i);
+            }
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+            this->assert_true(large.getStorageBackend() != mm::StorageBackend::Heap, "Large buffer is mapped.");
+#endif
+            if (large.getStorageBackend() == mm::StorageBackend::HugePages)
+            {
+                this->assert_true(large.getPageSize() > small.getPageSize(), "Huge pages are larger.");
+            }
+
+            *large.allocateMemory() = static_cast<long long>(count);
+            policy.hugePages_ = false;
+            large.setStoragePolicy(policy);
+            large.changeCapacity(4 * count);
+#if defined(DS_COMPACT_MEMORY_MREMAP)
+            this->assert_true(large.getStorageBackend() == mm::StorageBackend::Mapped, "Huge pages are not advised.");
+#endif
+            this->assert_equals(small.getPageSize(), large.getPageSize());
+
+            bool kept = true;
+            for (size_t i = 0; i <= count; ++i)
+            {
+                kept = kept && large.getBlockAt(i) == static_cast<long long>(i);
+            }
+            this->assert_true(kept, "Blocks are kept.");
+
+            large.changeCapacity(16);
+            this->assert_true(large.getStorageBackend() == mm::StorageBackend::Heap, "Shrunk buffer is on the heap.");
+            this->assert_equals(15LL, large.getBlockAt(15));
+
+            mm::CompactMemoryManager<std::string> strings;
+            strings.setStoragePolicy(policy);
+            strings.changeCapacity(count);
+            this->assert_true(strings.getStorageBackend() == mm::StorageBackend::Heap, "Only relocatable blocks are mapped.");
+        }
+    };
+
+    /**
+     * @brief Tests clustered inserts and removals in the gap buffer layout against a vector.
+     */
+    class CompactMemoryManagerTestGapBuffer : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestGapBuffer() :
+            LeafTest("gapBuffer")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::CompactMemoryManager<long long> manager;
+            manager.setGapBuffer(true);
+            this->assert_true(manager.isGapBuffer(), "Gap buffer is on.");
+
+            std::vector<long long> expected;
+            size_t cursor = 0;
+            long long next = 0;
+            for (int round = 0; round < 200; ++round)
+            {
+                cursor = (cursor * 7 + 13) % (expected.size() + 1);
+                for (int i = 0; i < 8; ++i)
+                {
+                    *manager.allocateMemoryAt(cursor) = next;
+                    expected.insert(expected.begin() + cursor, next);
+                    ++next;
+                    ++cursor;
+                }
+                if (round % 3 == 0 && cursor > 2)
+                {
+                    manager.releaseMemoryAt(cursor - 2);
+                    expected.erase(expected.begin() + (cursor - 2));
+                    --cursor;
+                }
+            }
+
+            this->assert_equals(expected.size(), manager.getAllocatedBlockCount());
+            bool same = true;
+            bool indexed = true;
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                same = same && manager.getBlockAt(i) == expected[i];
+                indexed = indexed && manager.calculateIndex(manager.getBlockAt(i)) == i;
+            }
+            this->assert_true(same, "Blocks follow the vector.");
+            this->assert_true(indexed, "Indices are mapped back.");
+
+            mm::CompactMemoryManager<long long> copy(manager);
+            this->assert_true(copy.isGapBuffer(), "Copy keeps the layout.");
+            this->assert_true(copy.equals(manager), "Copy equals the original.");
+
+            manager.makeContiguous();
+            bool contiguous = true;
+            for (size_t i = 0; i < expected.size(); ++i)
+            {
+                contiguous = contiguous && *(&manager.getBlockAt(0) + i) == expected[i];
+            }
+            this->assert_true(contiguous, "Blocks are adjacent.");
+
+            manager.releaseMemory(&manager.getBlockAt(expected.size() / 2));
+            this->assert_equals(expected.size() / 2, manager.getAllocatedBlockCount());
+            manager.setGapBuffer(false);
+            manager.changeCapacity(expected.size());
+            this->assert_equals(expected[expected.size() / 2 - 1], manager.getBlockAt(expected.size() / 2 - 1));
+        }
+    };
+
+    /**
+     * @brief Tests that buffers keep the required alignment when allocated and reallocated.
+     */
+    class CompactMemoryManagerTestAlignment : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestAlignment() :
+            LeafTest("alignment")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::CompactMemoryManager<double> manager;
+            for (int i = 0; i < 3; ++i)
+            {
+                *manager.allocateMemory() = i;
+            }
+
+            mm::StoragePolicy policy;
+            policy.alignment_ = CACHE_LINE_SIZE;
+            manager.setStoragePolicy(policy);
+            this->assert_equals(CACHE_LINE_SIZE, manager.getAlignment());
+            this->assert_true(isAligned(&manager.getBlockAt(0), CACHE_LINE_SIZE), "Buffer is realigned.");
+
+            bool aligned = true;
+            for (int i = 3; i < 1000; ++i)
+            {
+                *manager.allocateMemory() = i;
+                aligned = aligned && isAligned(&manager.getBlockAt(0), CACHE_LINE_SIZE);
+            }
+            manager.changeCapacity(500);
+            aligned = aligned && isAligned(&manager.getBlockAt(0), CACHE_LINE_SIZE);
+            this->assert_true(aligned, "Grown and shrunk buffers stay aligned.");
+            this->assert_true(manager.getStorageBackend() == mm::StorageBackend::AlignedHeap, "Buffer is an aligned one.");
+            this->assert_true(manager.getBlockAt(499) == 499.0, "Blocks are kept.");
+
+            mm::CompactMemoryManager<double> copy(manager);
+            this->assert_true(isAligned(&copy.getBlockAt(0), CACHE_LINE_SIZE), "Copy is aligned.");
+            this->assert_true(copy.equals(manager), "Copy equals the original.");
+
+            policy.alignment_ = 3;
+            bool thrown = false;
+            try
+            {
+                manager.setStoragePolicy(policy);
+            }
+            catch (const std::invalid_argument&)
+            {
+                thrown = true;
+            }
+            this->assert_true(thrown, "Alignment must be a power of two.");
+
+            using Counter = mm::PaddedBlock<long long>;
+            this->assert_equals(CACHE_LINE_SIZE, sizeof(Counter));
+            mm::CompactMemoryManager<Counter> counters;
+            bool separated = true;
+            for (int i = 0; i < 100; ++i)
+            {
+                counters.allocateMemory()->data_ = i;
+            }
+            for (size_t i = 0; i < counters.getAllocatedBlockCount(); ++i)
+            {
+                separated = separated && isAligned(&counters.getBlockAt(i), CACHE_LINE_SIZE);
+            }
+            this->assert_true(separated, "Every counter starts its own cache line.");
+        }
+
+    private:
+        static bool isAligned(const void* address, size_t alignment)
+        {
+            return reinterpret_cast<std::uintptr_t>(address) % alignment == 0;
+        }
+    };
+
     /**
      * @brief All CompactMemoryManager leaf tests.
      */
@@ -401,6 +705,11 @@ namespace ds::tests
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateAddress>());
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateIndex>());
             this->add_test(std::make_unique<CompactMemoryManagerSwap>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestGrowth>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestRelocate>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestStorage>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestGapBuffer>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestAlignment>());
         }
     };
 }
@@ -2,7 +2,11 @@
 
 #include <tests/_details/test.hpp>
 #include <tests/mm/memory_manager.test.h>
+#include <libds/amt/implicit_sequence.h>
+#include <libds/mm/compact_memory_manager.h>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 namespace ds::tests
@@ -84,6 +88,71 @@ namespace ds::tests
         }
     };
 
+    class MemoryManagerTestStatistics : public LeafTest
+    {
+    public:
+        MemoryManagerTestStatistics() :
+            LeafTest("statistics")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::MemoryManager<long long> manager;
+            std::vector<long long*> blocks;
+            for (int i = 0; i < 5; ++i)
+            {
+                blocks.push_back(manager.allocateMemory());
+            }
+            manager.releaseMemory(blocks.back());
+            manager.releaseMemory(blocks.front());
+            blocks.push_back(manager.allocateMemory());
+
+            const mm::MemoryStatistics statistics = manager.getStatistics();
+            this->assert_equals(size_t{ 4 }, statistics.liveBlockCount_);
+            this->assert_equals(4 * sizeof(long long), statistics.getLiveSize());
+            this->assert_equals(size_t{ 5 }, statistics.peakBlockCount_);
+            this->assert_equals(size_t{ 6 }, statistics.allocationCount_);
+            this->assert_equals(size_t{ 2 }, statistics.releaseCount_);
+            this->assert_equals(size_t{ 0 }, statistics.getWasteSize());
+            for (size_t i = 1; i < blocks.size(); ++i)
+            {
+                if (i != 4)
+                {
+                    manager.releaseMemory(blocks[i]);
+                }
+            }
+
+            mm::CompactMemoryManager<long long> compact(16);
+            for (int i = 0; i < 10; ++i)
+            {
+                compact.allocateMemory();
+            }
+            compact.releaseMemory(&compact.getBlockAt(6));
+            const mm::MemoryStatistics compactStatistics = compact.getStatistics();
+            this->assert_equals(size_t{ 6 }, compactStatistics.liveBlockCount_);
+            this->assert_equals(size_t{ 10 }, compactStatistics.peakBlockCount_);
+            this->assert_equals(size_t{ 4 }, compactStatistics.releaseCount_);
+            this->assert_equals(16 * sizeof(long long), compactStatistics.capacitySize_);
+            this->assert_equals(10 * sizeof(long long), compactStatistics.getWasteSize());
+
+            amt::ImplicitSequence<int> sequence;
+            sequence.insertLast();
+            this->assert_equals(size_t{ 1 }, sequence.getMemoryStatistics().liveBlockCount_);
+
+            mm::MemoryReport report;
+            report.add("compact", compactStatistics);
+            std::ostringstream json;
+            report.writeJson(json);
+            this->assert_equals(
+                std::string("{\"compact\":{\"blockSize\":8,\"liveBlocks\":6,\"liveBytes\":48,\"peakBlocks\":10,"
+                    "\"peakBytes\":80,\"allocations\":10,\"releases\":4,\"capacityBytes\":128,\"wasteBytes\":80}}"),
+                json.str()
+            );
+        }
+    };
+
     class MemoryManagerTest : public CompositeTest
     {
     public:
@@ -93,6 +162,7 @@ namespace ds::tests
             this->add_test(std::make_unique<MemoryManagerTestAllocate>());
             this->add_test(std::make_unique<MemoryManagerTestRelease>());
             this->add_test(std::make_unique<MemoryManagerTestCounts>());
+            this->add_test(std::make_unique<MemoryManagerTestStatistics>());
         }
     };
 }
\ No newline at end of file
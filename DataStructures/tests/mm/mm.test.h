@@ -3,6 +3,9 @@
 #include <tests/_details/test.hpp>
 #include <tests/mm/memory_manager.test.h>
 #include <tests/mm/compact_memory_manager.test.h>
+#include <tests/mm/pool_memory_manager.test.h>
+#include <tests/mm/arena_memory_manager.test.h>
+#include <tests/mm/thread_caching_memory_manager.test.h>
 #include <memory>
 
 namespace ds::tests
@@ -15,6 +18,9 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<MemoryManagerTest>());
             this->add_test(std::make_unique<CompactMemoryManagerTest>());
+            this->add_test(std::make_unique<PoolMemoryManagerTest>());
+            this->add_test(std::make_unique<ArenaMemoryManagerTest>());
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTest>());
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/pool_memory_manager.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <libds/amt/explicit_sequence.h>
+#include <memory>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests that blocks are taken from a slab in address order and that slabs grow.
+     */
+    class PoolMemoryManagerTestAllocate : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestAllocate() :
+            LeafTest("allocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t slabSize = 16;
+            const size_t n = 100;
+            mm::PoolMemoryManager<long long> manager(slabSize);
+            std::vector<long long*> blocks;
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                long long* block = manager.allocateMemory();
+                *block = static_cast<long long>(i);
+                blocks.push_back(block);
+            }
+
+            bool adjacent = true;
+            for (size_t i = 1; i < slabSize; ++i)
+            {
+                adjacent = adjacent && blocks[i] == blocks[i - 1] + 1;
+            }
+            bool kept = true;
+            for (size_t i = 0; i < n; ++i)
+            {
+                kept = kept && *blocks[i] == static_cast<long long>(i);
+            }
+
+            this->assert_true(adjacent, "Blocks of the first slab are adjacent.");
+            this->assert_true(kept, "Blocks do not overlap.");
+            this->assert_equals(n, manager.getAllocatedBlockCount());
+            this->assert_equals(size_t{ 3 }, manager.getSlabCount(), "Slabs double in size.");
+            this->assert_equals(size_t{ 16 + 32 + 64 }, manager.getCapacity());
+
+            for (long long* block : blocks)
+            {
+                manager.releaseMemory(block);
+            }
+            this->assert_equals(size_t{ 0 }, manager.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Tests that released blocks are reused before new ones are taken.
+     */
+    class PoolMemoryManagerTestReuse : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestReuse() :
+            LeafTest("reuse")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PoolMemoryManager<long long> manager;
+            long long* first = manager.allocateMemory();
+            long long* second = manager.allocateMemory();
+            long long* third = manager.allocateMemory();
+
+            manager.releaseMemory(first);
+            manager.releaseAndSetNull(third);
+
+            this->assert_null(third);
+            this->assert_equals(first + 2, manager.allocateMemory(), "Last released block is reused first.");
+            this->assert_equals(first, manager.allocateMemory());
+            this->assert_equals(first + 3, manager.allocateMemory(), "Fresh block follows the used ones.");
+            this->assert_equals(size_t{ 4 }, manager.getAllocatedBlockCount());
+            this->assert_equals(size_t{ 1 }, manager.getSlabCount());
+            static_cast<void>(second);
+        }
+    };
+
+    /**
+     * @brief Tests explicit structures whose blocks are allocated by a pool.
+     */
+    class PoolMemoryManagerTestStructures : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestStructures() :
+            LeafTest("structures")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using ListBlock = amt::DoublyLinkedSequence<int>::BlockType;
+            amt::DoublyLinkedSequence<int> list(new mm::PoolMemoryManager<ListBlock>());
+            const int n = 1000;
+            for (int i = 0; i < n; ++i)
+            {
+                list.insertLast().data_ = i;
+            }
+            for (int i = 0; i < n / 2; ++i)
+            {
+                list.removeFirst();
+            }
+            for (int i = 0; i < n / 2; ++i)
+            {
+                list.insertFirst().data_ = n / 2 - 1 - i;
+            }
+
+            bool ordered = true;
+            int expected = 0;
+            list.processAllBlocksForward([&](const ListBlock* block)
+                {
+                    ordered = ordered && block->data_ == expected++;
+                });
+            this->assert_equals(static_cast<size_t>(n), list.size());
+            this->assert_true(ordered, "List keeps its order.");
+
+            using TreeBlock = amt::MultiWayExplicitHierarchy<int>::BlockType;
+            amt::MultiWayExplicitHierarchy<int> tree(new mm::PoolMemoryManager<TreeBlock>());
+            TreeBlock& root = tree.emplaceRoot();
+            for (size_t i = 0; i < 10; ++i)
+            {
+                TreeBlock& son = tree.emplaceSon(root, i);
+                tree.emplaceSon(son, 0).data_ = static_cast<int>(i);
+            }
+            this->assert_equals(size_t{ 21 }, tree.size());
+            tree.removeSon(root, 3);
+            this->assert_equals(size_t{ 19 }, tree.size());
+        }
+    };
+
+    /**
+     * @brief All pool memory manager tests.
+     */
+    class PoolMemoryManagerTest : public CompositeTest
+    {
+    public:
+        PoolMemoryManagerTest() :
+            CompositeTest("PoolMemoryManager")
+        {
+            this->add_test(std::make_unique<PoolMemoryManagerTestAllocate>());
+            this->add_test(std::make_unique<PoolMemoryManagerTestReuse>());
+            this->add_test(std::make_unique<PoolMemoryManagerTestStructures>());
+        }
+    };
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/thread_caching_memory_manager.h>
+#include <libds/amt/explicit_sequence.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests that a thread reuses its own released blocks and returns surplus batches.
+     */
+    class ThreadCachingMemoryManagerTestReuse : public LeafTest
+    {
+    public:
+        ThreadCachingMemoryManagerTestReuse() :
+            LeafTest("reuse")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using Manager = mm::ThreadCachingMemoryManager<Block>;
+            Manager manager;
+
+            Block* first = manager.allocateMemory();
+            this->assert_equals(Manager::BATCH_SIZE - 1, Manager::getThreadCacheSize(), "Cache is refilled by a batch.");
+            manager.releaseMemory(first);
+            this->assert_equals(first, manager.allocateMemory(), "Last released block is reused first.");
+            manager.releaseMemory(first);
+
+            std::vector<Block*> blocks;
+            for (size_t i = 0; i < 3 * Manager::BATCH_SIZE; ++i)
+            {
+                blocks.push_back(manager.allocateMemory());
+            }
+            this->assert_equals(blocks.size(), manager.getAllocatedBlockCount());
+            const size_t centralSize = Manager::getCentralCacheSize();
+
+            for (Block* block : blocks)
+            {
+                manager.releaseMemory(block);
+            }
+            this->assert_equals(size_t{ 0 }, manager.getAllocatedBlockCount());
+            this->assert_true(Manager::getThreadCacheSize() < 2 * Manager::BATCH_SIZE, "Cache stays bounded.");
+            this->assert_true(Manager::getCentralCacheSize() > centralSize, "Surplus batches are returned.");
+        }
+
+    private:
+        struct Block
+        {
+            long long data_[2];
+        };
+    };
+
+    /**
+     * @brief Tests that blocks released by another thread come back through the central pool.
+     */
+    class ThreadCachingMemoryManagerTestCrossThread : public LeafTest
+    {
+    public:
+        ThreadCachingMemoryManagerTestCrossThread() :
+            LeafTest("cross-thread")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using Manager = mm::ThreadCachingMemoryManager<Block>;
+            Manager manager;
+            const size_t n = 100;
+
+            std::vector<Block*> blocks;
+            for (size_t i = 0; i < n; ++i)
+            {
+                blocks.push_back(manager.allocateMemory());
+            }
+            const size_t centralSize = Manager::getCentralCacheSize();
+
+            size_t releasingCacheSize = 0;
+            std::thread releasing([&]()
+                {
+                    for (Block* block : blocks)
+                    {
+                        manager.releaseMemory(block);
+                    }
+                    releasingCacheSize = Manager::getThreadCacheSize();
+                });
+            releasing.join();
+
+            this->assert_true(releasingCacheSize > 0, "Released blocks go to the releasing thread.");
+            this->assert_equals(centralSize + n, Manager::getCentralCacheSize(), "Exiting thread returns its cache.");
+            this->assert_equals(size_t{ 0 }, manager.getAllocatedBlockCount());
+        }
+
+    private:
+        struct Block
+        {
+            long long data_[2];
+        };
+    };
+
+    /**
+     * @brief Tests lists built and torn down by several threads at once.
+     */
+    class ThreadCachingMemoryManagerTestStructures : public LeafTest
+    {
+    public:
+        ThreadCachingMemoryManagerTestStructures() :
+            LeafTest("structures")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using ListBlock = amt::DoublyLinkedSequence<int>::BlockType;
+            const size_t threadCount = 4;
+            const int n = 10000;
+            std::vector<int> ordered(threadCount, 0);
+            std::vector<std::thread> threads;
+
+            for (size_t t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&ordered, t, n]()
+                    {
+                        amt::DoublyLinkedSequence<int> list(new mm::ThreadCachingMemoryManager<ListBlock>());
+                        for (int i = 0; i < n; ++i)
+                        {
+                            list.insertLast().data_ = i;
+                        }
+                        for (int i = 0; i < n / 2; ++i)
+                        {
+                            list.removeFirst();
+                        }
+
+                        int expected = n / 2;
+                        bool isOrdered = list.size() == static_cast<size_t>(n / 2);
+                        list.processAllBlocksForward([&](const ListBlock* block)
+                            {
+                                isOrdered = isOrdered && block->data_ == expected++;
+                            });
+                        ordered[t] = isOrdered ? 1 : 0;
+                    });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            size_t orderedCount = 0;
+            for (int isOrdered : ordered)
+            {
+                orderedCount += static_cast<size_t>(isOrdered);
+            }
+            this->assert_equals(threadCount, orderedCount, "Every list keeps its order.");
+        }
+    };
+
+    /**
+     * @brief All thread caching memory manager tests.
+     */
+    class ThreadCachingMemoryManagerTest : public CompositeTest
+    {
+    public:
+        ThreadCachingMemoryManagerTest() :
+            CompositeTest("ThreadCachingMemoryManager")
+        {
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTestReuse>());
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTestCrossThread>());
+            this->add_test(std::make_unique<ThreadCachingMemoryManagerTestStructures>());
+        }
+    };
+}
@@ -2,6 +2,11 @@
 
 #include <tests/root.h>
 #include <complexities/list_analyzer.h>
+#include <complexities/concurrent_queue_analyzer.h>
+#include <complexities/concurrent_stack_analyzer.h>
+#include <complexities/memory_manager_analyzer.h>
+#include <complexities/sort_analyzer.h>
+#include <complexities/table_analyzer.h>
 
 #include <msclr\marshal_cppstd.h>
 
@@ -18,6 +23,7 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests()
     auto mm   = std::make_unique<ds::tests::CompositeTest>("mm");
 	auto amt  = std::make_unique<ds::tests::CompositeTest>("amt");
 	auto adt  = std::make_unique<ds::tests::CompositeTest>("adt");
+	auto exec = std::make_unique<ds::tests::CompositeTest>("exec");
 
 	mm->add_test(std::make_unique<ds::tests::MemoryManagerTest>());
 
@@ -45,6 +51,8 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests()
 	//adt->add_test(std::make_unique<ds::tests::StackTest>());
 	//adt->add_test(std::make_unique<ds::tests::QueueTest>());
 	//adt->add_test(std::make_unique<ds::tests::PriorityQueueTest>());
+	adt->add_test(std::make_unique<ds::tests::ConcurrentQueueTest>());
+	adt->add_test(std::make_unique<ds::tests::ConcurrentStackTest>());
 
 	// TODO 10
 	//adt->add_test(std::make_unique<ds::tests::SequenceTableTest>());
@@ -55,9 +63,13 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests()
 	// TODO 12
 	//adt->add_test(std::make_unique<ds::tests::SortTest>());
 
+	exec->add_test(std::make_unique<ds::tests::WorkStealingDequeTest>());
+	exec->add_test(std::make_unique<ds::tests::ThreadPoolTest>());
+
 	root->add_test(std::move(mm));
 	root->add_test(std::move(amt));
 	root->add_test(std::move(adt));
+	root->add_test(std::move(exec));
 	std::vector<std::unique_ptr<ds::tests::Test>> tests;
 	tests.emplace_back(std::move(root));
 	return tests;
@@ -70,6 +82,12 @@ std::vector<std::unique_ptr<ds::utils::Analyzer>> createAnalyzers()
 	analyzers.emplace_back(std::make_unique<ds::utils::ListsAnalyzer>());
 	analyzers.emplace_back(std::make_unique<ds::utils::MatrixAnalyzerContainer>());
 	analyzers.emplace_back(std::make_unique<HashTableAnalyzerContainer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::ConcurrentQueuesAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::ConcurrentStacksAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::MemoryManagersAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::SortsAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::AdaptiveSortsAnalyzer>());
+	analyzers.emplace_back(std::make_unique<ds::utils::TablesAnalyzer>());
 	
 	// TODO 01
 	//analyzers.emplace_back(std::make_unique<ds::utils::ListsAnalyzer>());
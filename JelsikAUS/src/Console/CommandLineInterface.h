@@ -175,7 +175,7 @@ private:
 		std::cout << std::setw(16) << "lookup <name>" << " - Lookup Stop in a table\n";
 		std::cout << std::setw(16) << "help" << " - Show this help message\n";
 		std::cout << std::setw(16) << "exit" << " - Exit the console\n";
-		std::cout << std::setw(16) << "sort <type>" << " - Sort stops (id/location)\n";
+		std::cout << std::setw(16) << "sort <type> [count]" << " - Sort stops (id/location/latitude/longitude), optionally only the first <count>\n";
 	}
 	/**
 	 * @brief Handles the "lookup" command.
@@ -209,8 +209,9 @@ private:
 	}
 	/**
 	 * @brief Handles the "sort" command.
-	 * Sorts the stops by ID or location.
-	 * @param iss The input stream containing the sort type.
+	 * Sorts the stops by ID, location, or coordinate.
+	 * With a count, only that many first stops are sorted and printed.
+	 * @param iss The input stream containing the sort type and optional count.
 	 */
 
 	void handleSort(std::istringstream& iss)
@@ -218,47 +219,84 @@ private:
 		std::string sortType;
 		if (!(iss >> sortType))
 		{
-		 std::cout << "Please specify sort type 'id' or 'location'.\n";
+		 std::cout << "Please specify sort type 'id', 'location', 'latitude' or 'longitude'.\n";
 		 return;
 		}
 		auto allStops = iterator_.filterSubtree([](const Stop&) { return true; });
 
-		ds::amt::ImplicitSequence<Stop*> stopSequence;
-		for (const auto& stop : allStops)
+		// Only pointers into allStops are sorted, the stops themselves are neither copied nor moved.
+		ds::amt::ImplicitSequence<Stop*> stopSequence(allStops.size(), false);
+		for (auto& stop : allStops)
 		{
-			auto& node = stopSequence.insertLast();
-			node.data_ = new Stop(stop);
+			stopSequence.insertLast().data_ = &stop;
 		}
 
 		UniversalSorter<Stop*> sorter;
+		size_t count = 0;
+		const bool partial = static_cast<bool>(iss >> count) && count < stopSequence.size();
 
 		if (sortType == "id")
 		{
 			std::cout << "Sorting by ID...\n";
-			sorter.sort(stopSequence, StopComparator::compareID);
+			if (partial)
+			{
+				sorter.partialSort(stopSequence, count, StopComparator::compareID);
+			}
+			else
+			{
+				sorter.sortByStrings(stopSequence, { [](Stop* const& stop) { return std::string_view(stop->stop_ID()); } });
+			}
 		}
 		else if (sortType == "location")
 		{
 			std::cout << "Sorting stops by Municipality and Street...\n";
-			sorter.sort(stopSequence, StopComparator::compareStreetMunicipality);
+			if (partial)
+			{
+				sorter.partialSort(stopSequence, count, StopComparator::compareStreetMunicipality);
+			}
+			else
+			{
+				sorter.sortByStrings(stopSequence, {
+					[](Stop* const& stop) { return std::string_view(stop->municipality()); },
+					[](Stop* const& stop) { return std::string_view(stop->street()); }
+				});
+			}
 		}
-		else
+		else if (sortType == "latitude")
 		{
-			std::cout << "Unknown sort type. Use 'id' or 'location'.\n";
-			for (size_t i = 0; i < stopSequence.size(); ++i) {
-				delete stopSequence.access(i)->data_;
+			std::cout << "Sorting stops by Latitude...\n";
+			if (partial)
+			{
+				sorter.partialSort(stopSequence, count, StopComparator::compareLatitude);
+			}
+			else
+			{
+				sorter.sortByKey<std::uint64_t>(stopSequence, [](Stop* const& stop) { return ds::adt::RadixKeys::fromDouble(stop->latitude()); });
 			}
+		}
+		else if (sortType == "longitude")
+		{
+			std::cout << "Sorting stops by Longitude...\n";
+			if (partial)
+			{
+				sorter.partialSort(stopSequence, count, StopComparator::compareLongitude);
+			}
+			else
+			{
+				sorter.sortByKey<std::uint64_t>(stopSequence, [](Stop* const& stop) { return ds::adt::RadixKeys::fromDouble(stop->longitude()); });
+			}
+		}
+		else
+		{
+			std::cout << "Unknown sort type. Use 'id', 'location', 'latitude' or 'longitude'.\n";
 			return;
 		}
 		std::cout << "Sorted stops:\n";
-		for (size_t i = 0; i < stopSequence.size(); ++i)
+		const size_t shown = partial ? count : stopSequence.size();
+		for (size_t i = 0; i < shown; ++i)
 		{
 			Stop* stop = stopSequence.access(i)->data_;
 			std::cout << stop->toString();
 		}
-
-		for (size_t i = 0; i < stopSequence.size(); ++i) {
-			delete stopSequence.access(i)->data_;
-		}
 	}
 };
\ No newline at end of file
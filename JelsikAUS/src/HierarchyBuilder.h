@@ -57,12 +57,11 @@ class HierarchyBuilder
 	  *Each stop is inserted under its respective municipality and street. with the stop itself as the leaf node.
 	  *
 	  *@param stops vector of Stop objects loaded from the CSV file
-	  *@return A populated MultiWayExplicitHierarchy tree.
+	  *@param hierarchy empty hierarchy to populate; it is built once and never shrinks,
+	  *so it may allocate its nodes by a ds::mm::ArenaMemoryManager
 	  */
-		static HierarchyType buildHierarchy(const std::vector<Stop>& stops)
+		static void buildHierarchy(const std::vector<Stop>& stops, HierarchyType& hierarchy)
 		{
-			HierarchyType hierarchy;
-
 			//Create the root node "GRT"
 			Block& root = hierarchy.emplaceRoot();
 			root.data_.name = "GRT";
@@ -108,6 +107,5 @@ class HierarchyBuilder
 				stopNode.data_.stopData = stop; // Store the stop data
 				stopNode.data_.isStop = true; // Mark this node as a stop
 			}
-			return hierarchy;
 		}
 };
\ No newline at end of file
@@ -22,7 +22,7 @@ class Stop {
 			stop_lon_(stop_lon), street_(street),
 			municipality_(municipality) {
 		}
-		std::string stop_ID() const {
+		const std::string& stop_ID() const {
 			return stop_id_;
 		}
 		double latitude() const {
@@ -31,10 +31,10 @@ class Stop {
 		double longitude() const {
 			return stop_lon_;
 		}
-		std::string street() const {
+		const std::string& street() const {
 			return street_;
 		}
-		std::string municipality() const {
+		const std::string& municipality() const {
 			return municipality_;
 		}
 		std::string toString() const {
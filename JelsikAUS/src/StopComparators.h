@@ -21,4 +21,14 @@ namespace StopComparator
 		{
 			return a->stop_ID() < b->stop_ID();
 		};
+	inline std::function<bool(const Stop*, const Stop*)> compareLatitude =
+		[](const Stop* a, const Stop* b) -> bool
+		{
+			return a->latitude() < b->latitude();
+		};
+	inline std::function<bool(const Stop*, const Stop*)> compareLongitude =
+		[](const Stop* a, const Stop* b) -> bool
+		{
+			return a->longitude() < b->longitude();
+		};
 }
\ No newline at end of file
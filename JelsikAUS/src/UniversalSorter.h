@@ -1,7 +1,11 @@
 #pragma once
 #include <libds/adt/sorts.h>
 #include <libds/amt/implicit_sequence.h>
+#include <cstdint>
 #include <functional>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
 
 template<typename T>
 class UniversalSorter
@@ -9,7 +13,44 @@ class UniversalSorter
 public:
     void sort(ds::amt::ImplicitSequence<T>& seq, std::function<bool(const T&, const T&)> compare)
     {
-        ds::adt::QuickSort<T> sorter;
+        ds::adt::IntroSort<T> sorter;
         sorter.sort(seq, compare);
     }
+
+    template<typename Key>
+    void sortByKey(ds::amt::ImplicitSequence<T>& seq, std::function<Key(const T&)> getKey)
+    {
+        if constexpr (std::is_integral_v<Key>)
+        {
+            ds::adt::RadixSort<Key, T> sorter(getKey);
+            sorter.sort(seq);
+        }
+        else
+        {
+            ds::adt::applyPermutation(seq, ds::adt::argsort(seq, getKey));
+        }
+    }
+
+    template<typename Key>
+    ds::amt::ImplicitSequence<std::uint32_t> argsort(const ds::amt::ImplicitSequence<T>& seq, std::function<Key(const T&)> getKey)
+    {
+        return ds::adt::argsort(seq, getKey);
+    }
+
+    void sortByStrings(ds::amt::ImplicitSequence<T>& seq, std::initializer_list<std::function<std::string_view(const T&)>> getKeys)
+    {
+        ds::adt::MultikeyQuickSort<T> sorter(getKeys);
+        sorter.sort(seq);
+    }
+
+    void partialSort(ds::amt::ImplicitSequence<T>& seq, size_t count, std::function<bool(const T&, const T&)> compare)
+    {
+        ds::adt::partialSort(seq, count, compare);
+    }
+
+    T& nthElement(ds::amt::ImplicitSequence<T>& seq, size_t index, std::function<bool(const T&, const T&)> compare)
+    {
+        ds::adt::nthElement(seq, index, compare);
+        return seq.access(index)->data_;
+    }
 };
\ No newline at end of file
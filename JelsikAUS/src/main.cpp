@@ -1,4 +1,5 @@
 #include <libds/mm/compact_memory_manager.h>
+#include <libds/mm/arena_memory_manager.h>
 #include "CSVReader.h"
 #include "Stop.h"
 #include <string>
@@ -48,7 +49,9 @@ void location(std::vector<Stop> &stops, double lat1, double lat2, double lon1, d
 
 //running the program
 void RunConsole(std::vector<Stop> &stops) {
-	auto hierarchy = HierarchyBuilder::buildHierarchy(stops);
+	// Nodes are bump-allocated and all freed at once when the hierarchy goes out of scope.
+	HierarchyBuilder::HierarchyType hierarchy(new ds::mm::ArenaMemoryManager<HierarchyBuilder::Block>());
+	HierarchyBuilder::buildHierarchy(stops, hierarchy);
 	HierarchyIterator iterator(hierarchy);
 
 	// Create and populate StopTable